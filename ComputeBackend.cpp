@@ -0,0 +1,463 @@
+#include "ComputeBackend.hpp"
+
+#include "MatrixKernel.hpp"
+#include "ThreadPool.hpp"
+#include "VectorKernel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+ComputeBackend::ComputeBackend(std::string name) noexcept
+	: m_Name(std::move(name)) {}
+
+std::string_view ComputeBackend::GetName() const noexcept {
+	return m_Name;
+}
+
+namespace {
+	constexpr std::size_t ParallelElementThreshold = 1 << 18;
+	constexpr std::size_t ParallelElementBlockSize = 1 << 16;
+	constexpr std::size_t MaxParallelBlockCount = 64;
+
+	template<typename Function>
+	void ParallelFor(std::size_t n, std::size_t itemSize, const Function& function) {
+		const std::size_t workSize = n * itemSize;
+		const std::size_t blockCount = workSize < ParallelElementThreshold ? 1 :
+			std::min({ workSize / ParallelElementBlockSize, MaxParallelBlockCount, n });
+
+		if (blockCount == 1) {
+			function(std::size_t(0), std::size_t(0), n);
+
+			return;
+		}
+
+		const std::size_t blockAlignment = itemSize == 1 ? 16 : 1;
+		const std::size_t blockSize = ((n + blockCount - 1) / blockCount + blockAlignment - 1) /
+			blockAlignment * blockAlignment;
+		std::array<bool, MaxParallelBlockCount> isBlockDone{};
+		const auto runBlock = [&](std::size_t blockIndex) {
+			const std::size_t first = blockIndex * blockSize;
+
+			if (first < n) {
+				function(blockIndex, first, std::min(blockSize, n - first));
+			}
+
+			isBlockDone[blockIndex] = true;
+		};
+
+		try {
+			GetDefaultThreadPool().Run(blockCount, runBlock);
+		} catch (...) {
+			for (std::size_t i = 0; i < blockCount; ++i) {
+				if (!isBlockDone[i]) {
+					runBlock(i);
+				}
+			}
+		}
+	}
+	template<typename Function>
+	float ParallelReduce(std::size_t n, const Function& function) {
+		std::array<float, MaxParallelBlockCount> partialResults{};
+
+		ParallelFor(n, 1, [&](std::size_t blockIndex, std::size_t first, std::size_t count) {
+			partialResults[blockIndex] = function(first, count);
+		});
+
+		return std::accumulate(partialResults.begin(), partialResults.end(), 0.f);
+	}
+}
+
+class ReferenceBackendImpl final : public ComputeBackend {
+public:
+	ReferenceBackendImpl()
+		: ComputeBackend("Reference") {}
+	ReferenceBackendImpl(const ReferenceBackendImpl&) = delete;
+	virtual ~ReferenceBackendImpl() override = default;
+
+public:
+	ReferenceBackendImpl& operator=(const ReferenceBackendImpl&) = delete;
+
+public:
+	virtual void Gemm(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+		float beta, float* c, std::size_t ldc) const override {
+		ReferenceGemmKernel(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+	}
+	virtual void Gemv(bool transposeA, std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+		const float* x, std::size_t incx, float beta, float* y, std::size_t incy) const override {
+		const std::size_t ySize = transposeA ? n : m, xSize = transposeA ? m : n;
+
+		for (std::size_t i = 0; i < ySize; ++i) {
+			float sum = 0;
+
+			for (std::size_t p = 0; p < xSize; ++p) {
+				sum += (transposeA ? a[p * lda + i] : a[i * lda + p]) * x[p * incx];
+			}
+
+			float& yi = y[i * incy];
+
+			yi = alpha * sum + (beta == 0.f ? 0.f : beta * yi);
+		}
+	}
+	virtual void Ger(std::size_t m, std::size_t n, float alpha, const float* x, std::size_t incx,
+		const float* y, std::size_t incy, float* a, std::size_t lda) const override {
+		for (std::size_t i = 0; i < m; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				a[i * lda + j] += alpha * x[i * incx] * y[j * incy];
+			}
+		}
+	}
+
+	virtual void Add(std::size_t n, const float* x, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] += x[i];
+		}
+	}
+	virtual void Subtract(std::size_t n, const float* x, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] -= x[i];
+		}
+	}
+	virtual void Multiply(std::size_t n, const float* x, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] *= x[i];
+		}
+	}
+	virtual void Divide(std::size_t n, const float* x, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] /= x[i];
+		}
+	}
+	virtual void Max(std::size_t n, const float* x, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] = std::max(y[i], x[i]);
+		}
+	}
+	virtual void Scale(std::size_t n, float alpha, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] *= alpha;
+		}
+	}
+	virtual void Axpy(std::size_t n, float alpha, const float* x, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] += alpha * x[i];
+		}
+	}
+	virtual void AddScalar(std::size_t n, float alpha, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] += alpha;
+		}
+	}
+
+	virtual float Sum(std::size_t n, const float* x) const noexcept override {
+		double result = 0;
+
+		for (std::size_t i = 0; i < n; ++i) {
+			result += x[i];
+		}
+
+		return static_cast<float>(result);
+	}
+	virtual float SquaredDistance(std::size_t n, const float* x, const float* y) const noexcept override {
+		double result = 0;
+
+		for (std::size_t i = 0; i < n; ++i) {
+			const double difference = double(x[i]) - y[i];
+
+			result += difference * difference;
+		}
+
+		return static_cast<float>(result);
+	}
+
+	virtual void ReLU(std::size_t n, float slope, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] = y[i] >= 0.f ? y[i] : slope * y[i];
+		}
+	}
+	virtual void ReLUDerivative(std::size_t n, float slope, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] = y[i] >= 0.f ? 1.f : slope;
+		}
+	}
+	virtual void Exp(std::size_t n, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] = std::exp(y[i]);
+		}
+	}
+	virtual void Log(std::size_t n, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] = std::log(y[i]);
+		}
+	}
+	virtual void Tanh(std::size_t n, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] = std::tanh(y[i]);
+		}
+	}
+	virtual void Sigmoid(std::size_t n, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			y[i] = static_cast<float>(1 / (1 + std::exp(-double(y[i]))));
+		}
+	}
+	virtual void TanhDerivative(std::size_t n, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			const double value = std::cosh(double(y[i]));
+
+			y[i] = static_cast<float>(1 / (value * value));
+		}
+	}
+	virtual void SigmoidDerivative(std::size_t n, float* y) const noexcept override {
+		for (std::size_t i = 0; i < n; ++i) {
+			const double value = 1 / (1 + std::exp(-double(y[i])));
+
+			y[i] = static_cast<float>(value * (1 - value));
+		}
+	}
+};
+
+class SimdBackendImpl : public ComputeBackend {
+public:
+	SimdBackendImpl(std::string name = "SIMD")
+		: ComputeBackend(std::move(name)) {}
+	SimdBackendImpl(const SimdBackendImpl&) = delete;
+	virtual ~SimdBackendImpl() override = default;
+
+public:
+	SimdBackendImpl& operator=(const SimdBackendImpl&) = delete;
+
+public:
+	virtual void Gemm(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+		float beta, float* c, std::size_t ldc) const override {
+		SingleThreadedGemmKernel(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+	}
+	virtual void Gemv(bool transposeA, std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+		const float* x, std::size_t incx, float beta, float* y, std::size_t incy) const override {
+		GemvKernel(transposeA, m, n, alpha, a, lda, x, incx, beta, y, incy);
+	}
+	virtual void Ger(std::size_t m, std::size_t n, float alpha, const float* x, std::size_t incx,
+		const float* y, std::size_t incy, float* a, std::size_t lda) const override {
+		GerKernel(m, n, alpha, x, incx, y, incy, a, lda);
+	}
+
+	virtual void Add(std::size_t n, const float* x, float* y) const noexcept override {
+		AddKernel(n, x, y);
+	}
+	virtual void Subtract(std::size_t n, const float* x, float* y) const noexcept override {
+		SubtractKernel(n, x, y);
+	}
+	virtual void Multiply(std::size_t n, const float* x, float* y) const noexcept override {
+		MultiplyKernel(n, x, y);
+	}
+	virtual void Divide(std::size_t n, const float* x, float* y) const noexcept override {
+		DivideKernel(n, x, y);
+	}
+	virtual void Max(std::size_t n, const float* x, float* y) const noexcept override {
+		MaxKernel(n, x, y);
+	}
+	virtual void Scale(std::size_t n, float alpha, float* y) const noexcept override {
+		ScaleKernel(n, alpha, y);
+	}
+	virtual void Axpy(std::size_t n, float alpha, const float* x, float* y) const noexcept override {
+		AxpyKernel(n, alpha, x, y);
+	}
+	virtual void AddScalar(std::size_t n, float alpha, float* y) const noexcept override {
+		AddScalarKernel(n, alpha, y);
+	}
+
+	virtual float Sum(std::size_t n, const float* x) const noexcept override {
+		return SumKernel(n, x);
+	}
+	virtual float SquaredDistance(std::size_t n, const float* x, const float* y) const noexcept override {
+		return SquaredDistanceKernel(n, x, y);
+	}
+
+	virtual void ReLU(std::size_t n, float slope, float* y) const noexcept override {
+		ReLUKernel(n, slope, y);
+	}
+	virtual void ReLUDerivative(std::size_t n, float slope, float* y) const noexcept override {
+		ReLUDerivativeKernel(n, slope, y);
+	}
+	virtual void Exp(std::size_t n, float* y) const noexcept override {
+		ExpKernel(n, y);
+	}
+	virtual void Log(std::size_t n, float* y) const noexcept override {
+		LogKernel(n, y);
+	}
+	virtual void Tanh(std::size_t n, float* y) const noexcept override {
+		TanhKernel(n, y);
+	}
+	virtual void Sigmoid(std::size_t n, float* y) const noexcept override {
+		SigmoidKernel(n, y);
+	}
+	virtual void TanhDerivative(std::size_t n, float* y) const noexcept override {
+		TanhDerivativeKernel(n, y);
+	}
+	virtual void SigmoidDerivative(std::size_t n, float* y) const noexcept override {
+		SigmoidDerivativeKernel(n, y);
+	}
+};
+
+class ParallelBackendImpl final : public SimdBackendImpl {
+public:
+	ParallelBackendImpl()
+		: SimdBackendImpl("Parallel") {}
+	ParallelBackendImpl(const ParallelBackendImpl&) = delete;
+	virtual ~ParallelBackendImpl() override = default;
+
+public:
+	ParallelBackendImpl& operator=(const ParallelBackendImpl&) = delete;
+
+public:
+	virtual void Gemm(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+		float beta, float* c, std::size_t ldc) const override {
+		GemmKernel(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+	}
+	virtual void Gemv(bool transposeA, std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+		const float* x, std::size_t incx, float beta, float* y, std::size_t incy) const override {
+		if (transposeA) {
+			GemvKernel(true, m, n, alpha, a, lda, x, incx, beta, y, incy);
+
+			return;
+		}
+
+		ParallelFor(m, n, [=](std::size_t, std::size_t first, std::size_t count) {
+			GemvKernel(false, count, n, alpha, a + first * lda, lda, x, incx, beta, y + first * incy, incy);
+		});
+	}
+	virtual void Ger(std::size_t m, std::size_t n, float alpha, const float* x, std::size_t incx,
+		const float* y, std::size_t incy, float* a, std::size_t lda) const override {
+		ParallelFor(m, n, [=](std::size_t, std::size_t first, std::size_t count) {
+			GerKernel(count, n, alpha, x + first * incx, incx, y, incy, a + first * lda, lda);
+		});
+	}
+
+	virtual void Add(std::size_t n, const float* x, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			AddKernel(count, x + first, y + first);
+		});
+	}
+	virtual void Subtract(std::size_t n, const float* x, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			SubtractKernel(count, x + first, y + first);
+		});
+	}
+	virtual void Multiply(std::size_t n, const float* x, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			MultiplyKernel(count, x + first, y + first);
+		});
+	}
+	virtual void Divide(std::size_t n, const float* x, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			DivideKernel(count, x + first, y + first);
+		});
+	}
+	virtual void Max(std::size_t n, const float* x, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			MaxKernel(count, x + first, y + first);
+		});
+	}
+	virtual void Scale(std::size_t n, float alpha, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			ScaleKernel(count, alpha, y + first);
+		});
+	}
+	virtual void Axpy(std::size_t n, float alpha, const float* x, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			AxpyKernel(count, alpha, x + first, y + first);
+		});
+	}
+	virtual void AddScalar(std::size_t n, float alpha, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			AddScalarKernel(count, alpha, y + first);
+		});
+	}
+
+	virtual float Sum(std::size_t n, const float* x) const noexcept override {
+		return ParallelReduce(n, [=](std::size_t first, std::size_t count) {
+			return SumKernel(count, x + first);
+		});
+	}
+	virtual float SquaredDistance(std::size_t n, const float* x, const float* y) const noexcept override {
+		return ParallelReduce(n, [=](std::size_t first, std::size_t count) {
+			return SquaredDistanceKernel(count, x + first, y + first);
+		});
+	}
+
+	virtual void ReLU(std::size_t n, float slope, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			ReLUKernel(count, slope, y + first);
+		});
+	}
+	virtual void ReLUDerivative(std::size_t n, float slope, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			ReLUDerivativeKernel(count, slope, y + first);
+		});
+	}
+	virtual void Exp(std::size_t n, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			ExpKernel(count, y + first);
+		});
+	}
+	virtual void Log(std::size_t n, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			LogKernel(count, y + first);
+		});
+	}
+	virtual void Tanh(std::size_t n, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			TanhKernel(count, y + first);
+		});
+	}
+	virtual void Sigmoid(std::size_t n, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			SigmoidKernel(count, y + first);
+		});
+	}
+	virtual void TanhDerivative(std::size_t n, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			TanhDerivativeKernel(count, y + first);
+		});
+	}
+	virtual void SigmoidDerivative(std::size_t n, float* y) const noexcept override {
+		ParallelFor(n, 1, [=](std::size_t, std::size_t first, std::size_t count) {
+			SigmoidDerivativeKernel(count, y + first);
+		});
+	}
+};
+
+const std::shared_ptr<const ComputeBackend> ReferenceBackend = std::make_shared<ReferenceBackendImpl>();
+const std::shared_ptr<const ComputeBackend> SimdBackend = std::make_shared<SimdBackendImpl>();
+const std::shared_ptr<const ComputeBackend> ParallelBackend = std::make_shared<ParallelBackendImpl>();
+
+namespace {
+	std::atomic<const ComputeBackend*> g_ComputeBackend = nullptr;
+	thread_local const ComputeBackend* g_ScopedComputeBackend = nullptr;
+}
+
+const ComputeBackend& GetComputeBackend() noexcept {
+	if (g_ScopedComputeBackend) return *g_ScopedComputeBackend;
+
+	const ComputeBackend* const backend = g_ComputeBackend.load(std::memory_order_acquire);
+
+	return backend ? *backend : *ParallelBackend;
+}
+void SetComputeBackend(const ComputeBackend* backend) noexcept {
+	g_ComputeBackend.store(backend, std::memory_order_release);
+}
+
+ComputeBackendScope::ComputeBackendScope(const ComputeBackend* backend) noexcept
+	: m_PreviousBackend(g_ScopedComputeBackend) {
+	if (backend) {
+		g_ScopedComputeBackend = backend;
+	}
+}
+ComputeBackendScope::~ComputeBackendScope() {
+	g_ScopedComputeBackend = m_PreviousBackend;
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+class ComputeBackend {
+private:
+	std::string m_Name;
+
+public:
+	ComputeBackend(std::string name) noexcept;
+	ComputeBackend(const ComputeBackend&) = delete;
+	virtual ~ComputeBackend() = default;
+
+public:
+	ComputeBackend& operator=(const ComputeBackend&) = delete;
+
+public:
+	std::string_view GetName() const noexcept;
+
+	virtual void Gemm(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+		float beta, float* c, std::size_t ldc) const = 0;
+	virtual void Gemv(bool transposeA, std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+		const float* x, std::size_t incx, float beta, float* y, std::size_t incy) const = 0;
+	virtual void Ger(std::size_t m, std::size_t n, float alpha, const float* x, std::size_t incx,
+		const float* y, std::size_t incy, float* a, std::size_t lda) const = 0;
+
+	virtual void Add(std::size_t n, const float* x, float* y) const noexcept = 0;
+	virtual void Subtract(std::size_t n, const float* x, float* y) const noexcept = 0;
+	virtual void Multiply(std::size_t n, const float* x, float* y) const noexcept = 0;
+	virtual void Divide(std::size_t n, const float* x, float* y) const noexcept = 0;
+	virtual void Max(std::size_t n, const float* x, float* y) const noexcept = 0;
+	virtual void Scale(std::size_t n, float alpha, float* y) const noexcept = 0;
+	virtual void Axpy(std::size_t n, float alpha, const float* x, float* y) const noexcept = 0;
+	virtual void AddScalar(std::size_t n, float alpha, float* y) const noexcept = 0;
+
+	virtual float Sum(std::size_t n, const float* x) const noexcept = 0;
+	virtual float SquaredDistance(std::size_t n, const float* x, const float* y) const noexcept = 0;
+
+	virtual void ReLU(std::size_t n, float slope, float* y) const noexcept = 0;
+	virtual void ReLUDerivative(std::size_t n, float slope, float* y) const noexcept = 0;
+	virtual void Exp(std::size_t n, float* y) const noexcept = 0;
+	virtual void Log(std::size_t n, float* y) const noexcept = 0;
+	virtual void Tanh(std::size_t n, float* y) const noexcept = 0;
+	virtual void Sigmoid(std::size_t n, float* y) const noexcept = 0;
+	virtual void TanhDerivative(std::size_t n, float* y) const noexcept = 0;
+	virtual void SigmoidDerivative(std::size_t n, float* y) const noexcept = 0;
+};
+
+extern const std::shared_ptr<const ComputeBackend> ReferenceBackend;
+extern const std::shared_ptr<const ComputeBackend> SimdBackend;
+extern const std::shared_ptr<const ComputeBackend> ParallelBackend;
+
+const ComputeBackend& GetComputeBackend() noexcept;
+void SetComputeBackend(const ComputeBackend* backend) noexcept;
+
+class ComputeBackendScope final {
+private:
+	const ComputeBackend* m_PreviousBackend;
+
+public:
+	explicit ComputeBackendScope(const ComputeBackend* backend) noexcept;
+	ComputeBackendScope(const ComputeBackendScope&) = delete;
+	~ComputeBackendScope();
+
+public:
+	ComputeBackendScope& operator=(const ComputeBackendScope&) = delete;
+};
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "GemmTuner.hpp"
+
+#include "PALFileSystem.hpp"
+#include "VectorKernel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+	constexpr std::size_t TuningGemmSize = 384;
+	constexpr std::size_t TuningWideGemmSize = 4096;
+	constexpr std::size_t TuningRepeatCount = 3;
+
+	constexpr std::array<std::size_t, 3> MCCandidates = { 64, 128, 256 };
+	constexpr std::array<std::size_t, 3> KCCandidates = { 128, 256, 512 };
+	constexpr std::array<std::size_t, 3> NCCandidates = { 1024, 2048, 4096 };
+	constexpr std::array<std::size_t, 7> ParallelTuningSizes = { 32, 48, 64, 96, 128, 192, 256 };
+	constexpr std::size_t MaxParallelGemmThreshold = 512 * 512 * 512;
+
+	constexpr std::size_t MaxCachedMC = 4096;
+	constexpr std::size_t MaxCachedKC = 4096;
+	constexpr std::size_t MaxCachedNC = 65536;
+
+	std::string_view GetSimdLevelName(SimdLevel simdLevel) noexcept {
+		switch (simdLevel) {
+		case SimdLevel::SSE2:
+			return "SSE2";
+
+		case SimdLevel::AVX2:
+			return "AVX2";
+
+		case SimdLevel::AVX512:
+			return "AVX512";
+
+		default:
+			return "Scalar";
+		}
+	}
+
+	class GemmBenchmark final {
+	private:
+		std::vector<float> m_A, m_B, m_C;
+
+	public:
+		explicit GemmBenchmark(std::size_t elementCount) {
+			std::mt19937 mt(0);
+			std::uniform_real_distribution<float> dist(-1.f, 1.f);
+
+			m_A.resize(elementCount);
+			m_B.resize(elementCount);
+			m_C.resize(elementCount);
+
+			std::ranges::generate(m_A, [&] { return dist(mt); });
+			std::ranges::generate(m_B, [&] { return dist(mt); });
+		}
+		GemmBenchmark(const GemmBenchmark&) = delete;
+		~GemmBenchmark() = default;
+
+	public:
+		GemmBenchmark& operator=(const GemmBenchmark&) = delete;
+
+	public:
+		double Measure(std::size_t m, std::size_t n, std::size_t k, bool isParallel) {
+			double result = std::numeric_limits<double>::max();
+
+			for (std::size_t i = 0; i < TuningRepeatCount; ++i) {
+				const auto start = std::chrono::steady_clock::now();
+
+				if (isParallel) {
+					GemmKernel(false, false, m, n, k, 1.f, m_A.data(), k, m_B.data(), n, 0.f, m_C.data(), n);
+				} else {
+					SingleThreadedGemmKernel(false, false, m, n, k, 1.f, m_A.data(), k, m_B.data(), n, 0.f, m_C.data(), n);
+				}
+
+				const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+				result = std::min(result, elapsed.count());
+			}
+
+			return result;
+		}
+	};
+}
+
+std::string GetGemmTuningKey() {
+	std::ostringstream oss;
+
+	oss << GetProcessorName() << ';' << GetSimdLevelName(GetSimdLevel()) << ';' << GetGemmThreadCount();
+
+	return oss.str();
+}
+std::filesystem::path GetGemmTuningCachePath() {
+	const std::filesystem::path directory = GetUserDataDirectory();
+	if (directory.empty()) return {};
+
+	return directory / "GemmTuning.cache";
+}
+GemmParameters TuneGemmParameters() {
+	const GemmParameters previousParameters = GetGemmParameters();
+	GemmParameters result = previousParameters;
+
+	GemmBenchmark benchmark(TuningGemmSize * TuningWideGemmSize);
+	double bestTime = std::numeric_limits<double>::max();
+
+	const auto tryParameters = [&](const GemmParameters& candidate, std::size_t m, std::size_t n, std::size_t k) {
+		if (!IsSupportedGemmParameters(candidate)) return;
+
+		SetGemmParameters(candidate);
+
+		const double time = benchmark.Measure(m, n, k, false);
+
+		if (time < bestTime) {
+			result = candidate;
+			bestTime = time;
+		}
+	};
+
+	for (const auto& [mr, nr] : GetGemmMicroTileSizes()) {
+		for (const std::size_t mc : MCCandidates) {
+			for (const std::size_t kc : KCCandidates) {
+				tryParameters({ mr, nr, (mc + mr - 1) / mr * mr, kc, result.NC, result.ParallelThreshold },
+					TuningGemmSize, TuningGemmSize, TuningGemmSize);
+			}
+		}
+	}
+
+	const GemmParameters bestTileParameters = result;
+
+	bestTime = std::numeric_limits<double>::max();
+
+	for (const std::size_t nc : NCCandidates) {
+		GemmParameters candidate = bestTileParameters;
+
+		candidate.NC = (nc + candidate.NR - 1) / candidate.NR * candidate.NR;
+		tryParameters(candidate, TuningGemmSize, TuningWideGemmSize, TuningGemmSize);
+	}
+
+	if (GetGemmThreadCount() > 1) {
+		GemmParameters candidate = result;
+
+		candidate.ParallelThreshold = 0;
+		SetGemmParameters(candidate);
+
+		result.ParallelThreshold = MaxParallelGemmThreshold;
+
+		for (const std::size_t size : ParallelTuningSizes) {
+			if (benchmark.Measure(size, size, size, true) < benchmark.Measure(size, size, size, false)) {
+				result.ParallelThreshold = size * size * size;
+
+				break;
+			}
+		}
+	}
+
+	SetGemmParameters(previousParameters);
+
+	return result;
+}
+
+bool LoadGemmTuningCache(const std::filesystem::path& path) {
+	if (path.empty()) return false;
+
+	std::ifstream stream(path);
+	if (!stream) return false;
+
+	const std::string key = GetGemmTuningKey();
+
+	for (std::string line; std::getline(stream, line);) {
+		const std::size_t separator = line.find('\t');
+		if (separator == std::string::npos || line.compare(0, separator, key) != 0) continue;
+
+		std::istringstream iss(line.substr(separator + 1));
+		GemmParameters gemmParameters{};
+
+		if (!(iss >> gemmParameters.MR >> gemmParameters.NR >> gemmParameters.MC >> gemmParameters.KC >>
+			gemmParameters.NC >> gemmParameters.ParallelThreshold)) return false;
+		if (gemmParameters.MC > MaxCachedMC || gemmParameters.KC > MaxCachedKC ||
+			gemmParameters.NC > MaxCachedNC) return false;
+		if (!IsSupportedGemmParameters(gemmParameters)) return false;
+
+		SetGemmParameters(gemmParameters);
+
+		return true;
+	}
+
+	return false;
+}
+void SaveGemmTuningCache(const std::filesystem::path& path, const GemmParameters& gemmParameters) {
+	if (path.empty()) throw std::runtime_error("Failed to find a user data directory");
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(path.parent_path(), errorCode);
+	if (errorCode) throw std::runtime_error("Failed to create a directory");
+
+	const std::string key = GetGemmTuningKey();
+	std::vector<std::string> lines;
+
+	if (std::ifstream stream(path); stream) {
+		for (std::string line; std::getline(stream, line);) {
+			if (line.empty() || line.compare(0, line.find('\t'), key) == 0) continue;
+
+			lines.push_back(std::move(line));
+		}
+	}
+
+	std::ofstream stream(path);
+	if (!stream) throw std::runtime_error("Failed to open a file");
+
+	for (const auto& line : lines) {
+		stream << line << '\n';
+	}
+
+	stream << key << '\t' << gemmParameters.MR << ' ' << gemmParameters.NR << ' ' << gemmParameters.MC << ' ' <<
+		gemmParameters.KC << ' ' << gemmParameters.NC << ' ' << gemmParameters.ParallelThreshold << '\n';
+
+	if (!stream) throw std::runtime_error("Failed to write to a file");
+}
\ No newline at end of file
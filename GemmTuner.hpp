@@ -0,0 +1,13 @@
+#pragma once
+
+#include "MatrixKernel.hpp"
+
+#include <filesystem>
+#include <string>
+
+std::string GetGemmTuningKey();
+std::filesystem::path GetGemmTuningCachePath();
+GemmParameters TuneGemmParameters();
+
+bool LoadGemmTuningCache(const std::filesystem::path& path);
+void SaveGemmTuningCache(const std::filesystem::path& path, const GemmParameters& gemmParameters);
\ No newline at end of file
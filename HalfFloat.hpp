@@ -0,0 +1,51 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+enum class MatrixPrecision {
+	Float32,
+	BFloat16,
+	Float16,
+};
+
+inline std::uint16_t FloatToBFloat16(float value) noexcept {
+	const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+
+	if ((bits & 0x7FFFFFFF) > 0x7F800000) return static_cast<std::uint16_t>((bits >> 16) | 0x40);
+
+	return static_cast<std::uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+inline float BFloat16ToFloat(std::uint16_t value) noexcept {
+	return std::bit_cast<float>(static_cast<std::uint32_t>(value) << 16);
+}
+
+inline std::uint16_t FloatToFloat16(float value) noexcept {
+	const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+	const std::uint32_t sign = (bits >> 16) & 0x8000;
+	const std::uint32_t magnitude = bits & 0x7FFFFFFF;
+
+	if (magnitude > 0x7F800000) return static_cast<std::uint16_t>(sign | 0x7E00 | ((magnitude >> 13) & 0x3FF));
+	if (magnitude >= 0x477FF000) return static_cast<std::uint16_t>(sign | 0x7C00);
+	if (magnitude < 0x38800000) {
+		const float subnormal = std::bit_cast<float>(magnitude) + 0.5f;
+
+		return static_cast<std::uint16_t>(sign | (std::bit_cast<std::uint32_t>(subnormal) - 0x3F000000));
+	}
+
+	return static_cast<std::uint16_t>(sign | ((magnitude - 0x38000000 + 0xFFF + ((magnitude >> 13) & 1)) >> 13));
+}
+inline float Float16ToFloat(std::uint16_t value) noexcept {
+	const std::uint32_t sign = static_cast<std::uint32_t>(value & 0x8000) << 16;
+	const std::uint32_t exponent = (value >> 10) & 0x1F;
+	const std::uint32_t mantissa = value & 0x3FF;
+
+	if (exponent == 0x1F) return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13) | (mantissa ? 0x400000 : 0));
+	if (exponent == 0) {
+		const float subnormal = static_cast<float>(mantissa) * 0x1p-24f;
+
+		return std::bit_cast<float>(sign | std::bit_cast<std::uint32_t>(subnormal));
+	}
+
+	return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
\ No newline at end of file
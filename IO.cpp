@@ -8,10 +8,12 @@
 #include <iterator>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 static_assert(CHAR_BIT == 8);
 static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
 static_assert(std::numeric_limits<float>::is_iec559);
+static_assert(std::numeric_limits<double>::is_iec559);
 
 BinaryAdaptor::BinaryAdaptor(std::istream& stream, std::endian endian) noexcept
 	: m_IStream(&stream), m_Endian(endian) {
@@ -42,21 +44,24 @@ std::string BinaryAdaptor::ReadString() {
 
 	return EncodeToANSI(utf8);
 }
-Matrix BinaryAdaptor::ReadMatrix() {
+template<typename T>
+BasicMatrix<T> BinaryAdaptor::ReadMatrix() {
 	const std::uint32_t row = ReadInt32();
 	const std::uint32_t column = ReadInt32();
 	if (row == 0) return {};
 
-	Matrix result(row, column);
+	BasicMatrix<T> result(row, column);
 
 	for (std::uint32_t i = 0; i < row; ++i) {
 		for (std::uint32_t j = 0; j < column; ++j) {
-			result(i, j) = ReadFloat();
+			result(i, j) = ReadDecimal<T>();
 		}
 	}
 
 	return result;
 }
+template Matrix BinaryAdaptor::ReadMatrix<float>();
+template BasicMatrix<double> BinaryAdaptor::ReadMatrix<double>();
 std::int32_t BinaryAdaptor::ReadInt32() {
 	std::uint8_t buffer[sizeof(std::int32_t)];
 
@@ -87,6 +92,24 @@ float BinaryAdaptor::ReadFloat() {
 
 	return *reinterpret_cast<float*>(buffer);
 }
+double BinaryAdaptor::ReadDouble() {
+	std::uint8_t buffer[sizeof(double)];
+
+	ReadBytes(buffer, sizeof(buffer));
+	if (m_Endian != std::endian::native) {
+		std::reverse(std::begin(buffer), std::end(buffer));
+	}
+
+	return *reinterpret_cast<double*>(buffer);
+}
+template<typename T>
+T BinaryAdaptor::ReadDecimal() {
+	if constexpr (std::is_same_v<T, double>) {
+		return ReadDouble();
+	} else {
+		return ReadFloat();
+	}
+}
 
 void BinaryAdaptor::Write(const void* array, std::size_t byteCount) {
 	assert(m_OStream != nullptr);
@@ -102,7 +125,14 @@ void BinaryAdaptor::Write(const std::string& string) {
 	Write(static_cast<std::int32_t>(utf8.size()));
 	Write(utf8.data(), utf8.size());
 }
-void BinaryAdaptor::Write(const Matrix& matrix) {
+template<typename T>
+void BinaryAdaptor::Write(const BasicMatrix<T>& matrix) {
+	Write(static_cast<BasicConstMatrixView<T>>(matrix));
+}
+template void BinaryAdaptor::Write(const Matrix&);
+template void BinaryAdaptor::Write(const BasicMatrix<double>&);
+template<typename T>
+void BinaryAdaptor::Write(BasicConstMatrixView<T> matrix) {
 	const auto [row, column] = matrix.GetSize();
 
 	Write(static_cast<std::int32_t>(row));
@@ -114,6 +144,8 @@ void BinaryAdaptor::Write(const Matrix& matrix) {
 		}
 	}
 }
+template void BinaryAdaptor::Write(ConstMatrixView);
+template void BinaryAdaptor::Write(BasicConstMatrixView<double>);
 void BinaryAdaptor::Write(std::int32_t integer) {
 	std::uint8_t buffer[sizeof(std::int32_t)];
 	*reinterpret_cast<std::int32_t*>(buffer) = integer;
@@ -136,6 +168,15 @@ void BinaryAdaptor::Write(float decimal) {
 	std::uint8_t buffer[sizeof(float)];
 	*reinterpret_cast<float*>(buffer) = decimal;
 
+	if (m_Endian != std::endian::native) {
+		std::reverse(std::begin(buffer), std::end(buffer));
+	}
+	Write(buffer, sizeof(buffer));
+}
+void BinaryAdaptor::Write(double decimal) {
+	std::uint8_t buffer[sizeof(double)];
+	*reinterpret_cast<double*>(buffer) = decimal;
+
 	if (m_Endian != std::endian::native) {
 		std::reverse(std::begin(buffer), std::end(buffer));
 	}
@@ -28,15 +28,25 @@ public:
 public:
 	void ReadBytes(void* array, std::size_t byteCount);
 	std::string ReadString();
-	Matrix ReadMatrix();
+	template<typename T = float>
+	BasicMatrix<T> ReadMatrix();
 	std::int32_t ReadInt32();
 	std::int64_t ReadInt64();
 	float ReadFloat();
+	double ReadDouble();
 
 	void Write(const void* array, std::size_t byteCount);
 	void Write(const std::string& string);
-	void Write(const Matrix& matrix);
+	template<typename T>
+	void Write(const BasicMatrix<T>& matrix);
+	template<typename T>
+	void Write(BasicConstMatrixView<T> matrix);
 	void Write(std::int32_t integer);
 	void Write(std::int64_t integer);
 	void Write(float decimal);
+	void Write(double decimal);
+
+private:
+	template<typename T>
+	T ReadDecimal();
 };
\ No newline at end of file
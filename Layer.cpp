@@ -1,10 +1,67 @@
 #include "Layer.hpp"
 
+#include "ComputeBackend.hpp"
+
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <stdexcept>
+
+namespace {
+	MatrixPrecision GetStoragePrecision(const CompactMatrix& compactValue) noexcept {
+		return compactValue.IsEmpty() ? MatrixPrecision::Float32 : compactValue.GetPrecision();
+	}
+	void ConvertStorage(Matrix& value, CompactMatrix& compactValue, MatrixPrecision newPrecision) {
+		const MatrixPrecision precision = GetStoragePrecision(compactValue);
+
+		if (precision == newPrecision) return;
+
+		if (newPrecision == MatrixPrecision::Float32) {
+			value = compactValue.Expand();
+			compactValue = CompactMatrix();
+		} else if (precision == MatrixPrecision::Float32) {
+			compactValue.Assign(value, newPrecision);
+			value = Matrix();
+		} else {
+			compactValue.Assign(compactValue.Expand(), newPrecision);
+		}
+	}
+
+	template<AFunction Function>
+	void ActivateImpl(MatrixView values) noexcept {
+		const ComputeBackend& backend = GetComputeBackend();
+
+		TransformRows(values, [&backend](std::size_t n, float* y) noexcept {
+			if constexpr (Function == AFunction::Sigmoid) {
+				backend.Sigmoid(n, y);
+			} else if constexpr (Function == AFunction::Tanh) {
+				backend.Tanh(n, y);
+			} else if constexpr (Function == AFunction::ReLU) {
+				backend.ReLU(n, 0.f, y);
+			} else {
+				backend.ReLU(n, 0.01f, y);
+			}
+		});
+	}
+	template<AFunction Function>
+	void DifferentiateImpl(MatrixView values) noexcept {
+		const ComputeBackend& backend = GetComputeBackend();
+
+		TransformRows(values, [&backend](std::size_t n, float* y) noexcept {
+			if constexpr (Function == AFunction::Sigmoid) {
+				backend.SigmoidDerivative(n, y);
+			} else if constexpr (Function == AFunction::Tanh) {
+				backend.TanhDerivative(n, y);
+			} else if constexpr (Function == AFunction::ReLU) {
+				backend.ReLUDerivative(n, 0.f, y);
+			} else {
+				backend.ReLUDerivative(n, 0.01f, y);
+			}
+		});
+	}
+}
 
-Variable::Variable(std::map<std::string, Matrix>::iterator iterator) noexcept
+Variable::Variable(std::map<std::string, std::pair<Matrix, CompactMatrix>>::iterator iterator) noexcept
 	: m_Iterator(iterator) {}
 
 bool Variable::operator==(const Variable& other) noexcept {
@@ -15,13 +72,35 @@ std::string_view Variable::GetName() const noexcept {
 	return m_Iterator->first;
 }
 Matrix& Variable::GetValue() const noexcept {
-	return m_Iterator->second;
+	return m_Iterator->second.first;
 }
 Matrix& Variable::SetValue(Matrix newValue) const noexcept {
-	return m_Iterator->second = std::move(newValue);
+	m_Iterator->second.second = CompactMatrix();
+
+	return m_Iterator->second.first = std::move(newValue);
+}
+CompactMatrix& Variable::GetCompactValue() const noexcept {
+	return m_Iterator->second.second;
+}
+CompactMatrix& Variable::SetCompactValue(ConstMatrixView newValue, MatrixPrecision precision) const {
+	assert(precision != MatrixPrecision::Float32);
+
+	m_Iterator->second.first = Matrix();
+	m_Iterator->second.second.Assign(newValue, precision);
+
+	return m_Iterator->second.second;
+}
+Matrix Variable::GetExpandedValue() const {
+	return GetPrecision() == MatrixPrecision::Float32 ? GetValue() : GetCompactValue().Expand();
+}
+MatrixPrecision Variable::GetPrecision() const noexcept {
+	return GetStoragePrecision(GetCompactValue());
+}
+void Variable::SetPrecision(MatrixPrecision newPrecision) const {
+	ConvertStorage(GetValue(), GetCompactValue(), newPrecision);
 }
 
-ReadonlyVariable::ReadonlyVariable(std::map<std::string, Matrix>::const_iterator iterator) noexcept
+ReadonlyVariable::ReadonlyVariable(std::map<std::string, std::pair<Matrix, CompactMatrix>>::const_iterator iterator) noexcept
 	: m_Iterator(iterator) {}
 ReadonlyVariable::ReadonlyVariable(const Variable& variable) noexcept
 	: m_Iterator(variable.m_Iterator) {}
@@ -42,7 +121,16 @@ std::string_view ReadonlyVariable::GetName() const noexcept {
 	return m_Iterator->first;
 }
 const Matrix& ReadonlyVariable::GetValue() const noexcept {
-	return m_Iterator->second;
+	return m_Iterator->second.first;
+}
+const CompactMatrix& ReadonlyVariable::GetCompactValue() const noexcept {
+	return m_Iterator->second.second;
+}
+Matrix ReadonlyVariable::GetExpandedValue() const {
+	return GetPrecision() == MatrixPrecision::Float32 ? GetValue() : GetCompactValue().Expand();
+}
+MatrixPrecision ReadonlyVariable::GetPrecision() const noexcept {
+	return GetStoragePrecision(GetCompactValue());
 }
 
 ReadonlyVariable VariableTable::GetVariable(const std::string& name) const noexcept {
@@ -76,12 +164,11 @@ std::vector<Variable> VariableTable::GetAllVariables() {
 	return result;
 }
 Variable VariableTable::AddVariable(std::string name, Matrix initialValue) {
-	return m_Variables.insert_or_assign(std::move(name), std::move(initialValue)).first;
+	return m_Variables.insert_or_assign(std::move(name), std::make_pair(std::move(initialValue), CompactMatrix())).first;
 }
 
-Parameter::Parameter(std::map<std::string,
-	std::tuple<Matrix, Matrix, std::unique_ptr<VariableTable>>>::iterator iterator) noexcept
-	: m_Iterator(iterator) {}
+Parameter::Parameter(ParameterTable& table, std::map<std::string, ParameterEntry>::iterator iterator) noexcept
+	: m_Table(&table), m_Iterator(iterator) {}
 
 bool Parameter::operator==(const Parameter& other) noexcept {
 	return m_Iterator == other.m_Iterator;
@@ -90,29 +177,82 @@ bool Parameter::operator==(const Parameter& other) noexcept {
 std::string_view Parameter::GetName() const noexcept {
 	return m_Iterator->first;
 }
-Matrix& Parameter::GetValue() const noexcept {
-	return std::get<0>(m_Iterator->second);
+MatrixView Parameter::GetValue() const noexcept {
+	return m_Table->GetValue(m_Iterator->second);
 }
-Matrix& Parameter::SetValue(Matrix newValue) const noexcept {
-	return std::get<0>(m_Iterator->second) = std::move(newValue);
+MatrixView Parameter::SetValue(ConstMatrixView newValue) const {
+	ParameterEntry& entry = m_Iterator->second;
+
+	if (!entry.HasStorage || GetSize() != newValue.GetSize()) {
+		entry.RowSize = newValue.GetRowSize();
+		entry.ColumnSize = newValue.GetColumnSize();
+		entry.HasStorage = false;
+		entry.CompactValue = CompactMatrix();
+		ParameterArena::Assign({ m_Table });
+	}
+
+	Copy(GetValue(), newValue);
+
+	return GetValue();
 }
-Matrix& Parameter::GetGradient() const noexcept {
-	return std::get<1>(m_Iterator->second);
+MatrixView Parameter::GetGradient() const noexcept {
+	return m_Table->GetGradient(m_Iterator->second);
 }
-Matrix& Parameter::SetGradient(Matrix newGradient) const noexcept {
-	return std::get<1>(m_Iterator->second) = std::move(newGradient);
+MatrixView Parameter::SetGradient(ConstMatrixView newGradient) const noexcept {
+	const MatrixView gradient = GetGradient();
+
+	if (newGradient.GetSize() == gradient.GetSize()) {
+		Copy(gradient, newGradient);
+	} else {
+		Scale(gradient, 0.f);
+	}
+
+	return gradient;
 }
 VariableTable& Parameter::GetVariableTable() const noexcept {
-	return *std::get<2>(m_Iterator->second);
+	return *m_Iterator->second.Variables;
 }
+const CompactMatrix& Parameter::GetCompactValue() const noexcept {
+	return m_Iterator->second.CompactValue;
+}
+Matrix Parameter::GetExpandedValue() const {
+	return ReadonlyParameter(*this).GetExpandedValue();
+}
+std::pair<std::size_t, std::size_t> Parameter::GetSize() const noexcept {
+	return { m_Iterator->second.RowSize, m_Iterator->second.ColumnSize };
+}
+MatrixPrecision Parameter::GetPrecision() const noexcept {
+	return GetStoragePrecision(GetCompactValue());
+}
+void Parameter::SetPrecision(MatrixPrecision newPrecision) const {
+	ParameterEntry& entry = m_Iterator->second;
+	const MatrixPrecision precision = GetPrecision();
 
-ReadonlyParameter::ReadonlyParameter(std::map<std::string,
-	std::tuple<Matrix, Matrix, std::unique_ptr<VariableTable>>>::const_iterator iterator) noexcept
-	: m_Iterator(iterator) {}
+	if (precision == newPrecision) return;
+
+	if (newPrecision == MatrixPrecision::Float32) {
+		const CompactMatrix compactValue = std::move(entry.CompactValue);
+
+		entry.CompactValue = CompactMatrix();
+		ParameterArena::Assign({ m_Table });
+		compactValue.Expand(GetValue());
+	} else if (precision == MatrixPrecision::Float32) {
+		//  е   Ŀ ιǷ Ʒ  ⸦ ݳ
+		entry.CompactValue.Assign(GetValue(), newPrecision);
+		ParameterArena::Assign({ m_Table });
+	} else {
+		entry.CompactValue.Assign(entry.CompactValue.Expand(), newPrecision);
+	}
+}
+
+ReadonlyParameter::ReadonlyParameter(const ParameterTable& table,
+	std::map<std::string, ParameterEntry>::const_iterator iterator) noexcept
+	: m_Table(&table), m_Iterator(iterator) {}
 ReadonlyParameter::ReadonlyParameter(const Parameter& parameter) noexcept
-	: m_Iterator(parameter.m_Iterator) {}
+	: m_Table(parameter.m_Table), m_Iterator(parameter.m_Iterator) {}
 
 ReadonlyParameter& ReadonlyParameter::operator=(const Parameter& parameter) noexcept {
+	m_Table = parameter.m_Table;
 	m_Iterator = parameter.m_Iterator;
 
 	return *this;
@@ -127,33 +267,48 @@ bool ReadonlyParameter::operator==(const ReadonlyParameter& other) noexcept {
 std::string_view ReadonlyParameter::GetName() const noexcept {
 	return m_Iterator->first;
 }
-const Matrix& ReadonlyParameter::GetValue() const noexcept {
-	return std::get<0>(m_Iterator->second);
+ConstMatrixView ReadonlyParameter::GetValue() const noexcept {
+	return m_Table->GetValue(m_Iterator->second);
 }
-const Matrix& ReadonlyParameter::GetGradient() const noexcept {
-	return std::get<1>(m_Iterator->second);
+ConstMatrixView ReadonlyParameter::GetGradient() const noexcept {
+	return m_Table->GetGradient(m_Iterator->second);
 }
 const VariableTable& ReadonlyParameter::GetVariableTable() const noexcept {
-	return *std::get<2>(m_Iterator->second);
+	return *m_Iterator->second.Variables;
+}
+const CompactMatrix& ReadonlyParameter::GetCompactValue() const noexcept {
+	return m_Iterator->second.CompactValue;
+}
+Matrix ReadonlyParameter::GetExpandedValue() const {
+	if (GetPrecision() != MatrixPrecision::Float32) return GetCompactValue().Expand();
+	if (GetSize().first == 0) return Matrix();
+
+	return Matrix(GetValue());
+}
+std::pair<std::size_t, std::size_t> ReadonlyParameter::GetSize() const noexcept {
+	return { m_Iterator->second.RowSize, m_Iterator->second.ColumnSize };
+}
+MatrixPrecision ReadonlyParameter::GetPrecision() const noexcept {
+	return GetStoragePrecision(GetCompactValue());
 }
 
 ReadonlyParameter ParameterTable::GetParameter(const std::string& name) const noexcept {
 	const auto iterator = m_Parameters.find(name);
 	assert(iterator != m_Parameters.end());
 
-	return iterator;
+	return { *this, iterator };
 }
 Parameter ParameterTable::GetParameter(const std::string& name) noexcept {
 	const auto iterator = m_Parameters.find(name);
 	assert(iterator != m_Parameters.end());
 
-	return iterator;
+	return { *this, iterator };
 }
 std::vector<ReadonlyParameter> ParameterTable::GetAllParameters() const {
 	std::vector<ReadonlyParameter> result;
 
 	for (auto iter = m_Parameters.begin(); iter != m_Parameters.end(); ++iter) {
-		result.emplace_back(iter);
+		result.emplace_back(*this, iter);
 	}
 
 	return result;
@@ -162,14 +317,122 @@ std::vector<Parameter> ParameterTable::GetAllParameters() {
 	std::vector<Parameter> result;
 
 	for (auto iter = m_Parameters.begin(); iter != m_Parameters.end(); ++iter) {
-		result.emplace_back(iter);
+		result.emplace_back(*this, iter);
 	}
 
 	return result;
 }
-Parameter ParameterTable::AddParameter(std::string name, Matrix initialValue) {
-	return m_Parameters.insert_or_assign(std::move(name),
-		std::make_tuple(initialValue, Matrix{}, std::make_unique<VariableTable>())).first;
+Parameter ParameterTable::AddParameter(std::string name, ConstMatrixView initialValue) {
+	const auto iterator = m_Parameters.insert_or_assign(std::move(name), ParameterEntry()).first;
+	const Parameter parameter(*this, iterator);
+
+	parameter.SetValue(initialValue);
+
+	return parameter;
+}
+
+ConstMatrixView ParameterTable::GetValue(const ParameterEntry& entry) const noexcept {
+	if (!entry.HasStorage) return {};
+
+	return { m_Arena->GetValues().GetData() + entry.Offset, entry.RowSize, entry.ColumnSize, entry.Stride };
+}
+MatrixView ParameterTable::GetValue(const ParameterEntry& entry) noexcept {
+	if (!entry.HasStorage) return {};
+
+	return { m_Arena->GetValues().GetData() + entry.Offset, entry.RowSize, entry.ColumnSize, entry.Stride };
+}
+ConstMatrixView ParameterTable::GetGradient(const ParameterEntry& entry) const noexcept {
+	if (!entry.HasStorage) return {};
+
+	return { m_Arena->GetGradients().GetData() + entry.Offset, entry.RowSize, entry.ColumnSize, entry.Stride };
+}
+MatrixView ParameterTable::GetGradient(const ParameterEntry& entry) noexcept {
+	if (!entry.HasStorage) return {};
+
+	return { m_Arena->GetGradients().GetData() + entry.Offset, entry.RowSize, entry.ColumnSize, entry.Stride };
+}
+
+std::shared_ptr<ParameterArena> ParameterArena::Assign(const std::vector<ParameterTable*>& parameterTables) {
+	if (!parameterTables.empty()) {
+		const std::shared_ptr<ParameterArena>& arena = parameterTables.front()->m_Arena;
+
+		if (arena && arena->IsAssigned(parameterTables)) return arena;
+	}
+
+	constexpr std::size_t alignment = AlignedMatrixAllocator::Alignment / sizeof(float);
+
+	std::vector<std::size_t> offsets, strides;
+	std::size_t size = 0;
+
+	for (const ParameterTable* const parameterTable : parameterTables) {
+		for (const auto& [name, entry] : parameterTable->m_Parameters) {
+			const std::size_t stride = entry.ColumnSize ? GetMatrixAllocator().GetRowStride(entry.ColumnSize) : 0;
+
+			offsets.push_back(size);
+			strides.push_back(stride);
+
+			if (!entry.CompactValue.IsEmpty()) continue;
+
+			size += (entry.RowSize * stride + alignment - 1) / alignment * alignment;
+		}
+	}
+
+	const auto result = std::make_shared<ParameterArena>();
+
+	result->m_Tables.assign(parameterTables.begin(), parameterTables.end());
+	result->m_Elements = MatrixStorage<float>(size * 2, 0.f);
+	result->m_Size = size;
+
+	std::size_t index = 0;
+
+	for (ParameterTable* const parameterTable : parameterTables) {
+		for (auto& [name, entry] : parameterTable->m_Parameters) {
+			const bool hasStorage = entry.CompactValue.IsEmpty();
+			const MatrixView value(result->m_Elements.data() + offsets[index],
+				entry.RowSize, entry.ColumnSize, strides[index]);
+			const MatrixView gradient(value.GetData() + size, entry.RowSize, entry.ColumnSize, strides[index]);
+
+			if (hasStorage && entry.HasStorage) {
+				Copy(value, parameterTable->GetValue(entry));
+				Copy(gradient, parameterTable->GetGradient(entry));
+			}
+
+			entry.Offset = offsets[index];
+			entry.Stride = strides[index];
+			entry.HasStorage = hasStorage;
+			++index;
+		}
+
+		parameterTable->m_Arena = result;
+	}
+
+	return result;
+}
+bool ParameterArena::IsAssigned(const std::vector<ParameterTable*>& parameterTables) const noexcept {
+	if (!std::equal(m_Tables.begin(), m_Tables.end(), parameterTables.begin(), parameterTables.end())) return false;
+
+	return std::all_of(parameterTables.begin(), parameterTables.end(), [this](const ParameterTable* parameterTable) {
+		if (parameterTable->m_Arena.get() != this) return false;
+
+		return std::all_of(parameterTable->m_Parameters.begin(), parameterTable->m_Parameters.end(), [](const auto& parameter) {
+			return parameter.second.HasStorage == parameter.second.CompactValue.IsEmpty();
+		});
+	});
+}
+std::size_t ParameterArena::GetSize() const noexcept {
+	return m_Size;
+}
+ConstMatrixView ParameterArena::GetValues() const noexcept {
+	return { m_Elements.data(), 1, m_Size, m_Size };
+}
+MatrixView ParameterArena::GetValues() noexcept {
+	return { m_Elements.data(), 1, m_Size, m_Size };
+}
+ConstMatrixView ParameterArena::GetGradients() const noexcept {
+	return { m_Elements.data() + m_Size, 1, m_Size, m_Size };
+}
+MatrixView ParameterArena::GetGradients() noexcept {
+	return { m_Elements.data() + m_Size, 1, m_Size, m_Size };
 }
 
 Layer::Layer(std::string name)
@@ -183,18 +446,57 @@ std::string_view Layer::GetName() const noexcept {
 	return m_Name;
 }
 
-Matrix Layer::Forward(const Matrix& input) {
-	return m_LastForwardOutput.SetValue(ForwardImpl(m_LastForwardInput.SetValue(input)));
+const Matrix& Layer::Forward(const Matrix& input) {
+	m_IsLastForwardInputSparse = false;
+
+	if (m_Precision == MatrixPrecision::Float32) {
+		Matrix& lastInput = m_LastForwardInput.GetValue();
+		Matrix& lastOutput = m_LastForwardOutput.GetValue();
+
+		lastInput = input;
+		ForwardImpl(lastInput, lastOutput);
+
+		return lastOutput;
+	}
+
+	//  е    ķθ ϰ,   ѱ fp32   
+	ForwardImpl(input, m_CompactForwardOutput);
+	m_LastForwardInput.SetCompactValue(input, m_Precision);
+	m_LastForwardOutput.SetCompactValue(m_CompactForwardOutput, m_Precision);
+
+	return m_CompactForwardOutput;
+}
+const Matrix& Layer::Forward(const SparseMatrix& input) {
+	if (m_Precision != MatrixPrecision::Float32) return Forward(input.Expand());
+
+	Matrix& lastOutput = m_LastForwardOutput.GetValue();
+
+	m_LastSparseForwardInput = input;
+	m_IsLastForwardInputSparse = true;
+	ForwardSparseImpl(m_LastSparseForwardInput, lastOutput);
+
+	return lastOutput;
 }
 const Matrix& Layer::GetLastForwardInput() const noexcept {
 	return m_LastForwardInput.GetValue();
 }
+const SparseMatrix* Layer::GetLastSparseForwardInput() const noexcept {
+	return m_IsLastForwardInputSparse ? &m_LastSparseForwardInput : nullptr;
+}
 const Matrix& Layer::GetLastForwardOutput() const noexcept {
 	return m_LastForwardOutput.GetValue();
 }
 
-Matrix Layer::Backward(const Matrix& input) {
-	return m_LastBackwardOutput.SetValue(BackwardImpl(m_LastBackwardInput.SetValue(input)));
+const Matrix& Layer::Backward(const Matrix& input) {
+	if (m_Precision != MatrixPrecision::Float32) throw std::runtime_error("Backward requires fp32 precision");
+
+	Matrix& lastInput = m_LastBackwardInput.GetValue();
+	Matrix& lastOutput = m_LastBackwardOutput.GetValue();
+
+	lastInput = input;
+	BackwardImpl(lastInput, lastOutput);
+
+	return lastOutput;
 }
 const Matrix& Layer::GetLastBackwardInput() const noexcept {
 	return m_LastBackwardInput.GetValue();
@@ -215,6 +517,31 @@ const ParameterTable& Layer::GetParameterTable() const noexcept {
 ParameterTable& Layer::GetParameterTable() noexcept {
 	return m_ParameterTable;
 }
+MatrixPrecision Layer::GetPrecision() const noexcept {
+	return m_Precision;
+}
+void Layer::SetPrecision(MatrixPrecision newPrecision) {
+	for (auto& parameter : m_ParameterTable.GetAllParameters()) {
+		parameter.SetPrecision(newPrecision);
+	}
+
+	m_LastForwardInput.SetPrecision(newPrecision);
+	m_LastForwardOutput.SetPrecision(newPrecision);
+	m_LastBackwardInput.SetPrecision(newPrecision);
+	m_LastBackwardOutput.SetPrecision(newPrecision);
+	m_IsLastForwardInputSparse = false;
+	m_CompactForwardOutput = Matrix();
+	m_Precision = newPrecision;
+}
+
+void Layer::ForwardSparseImpl(const SparseMatrix& input, Matrix& output) {
+	Matrix& lastInput = m_LastForwardInput.GetValue();
+
+	lastInput.Resize(input.GetRowSize(), input.GetColumnSize());
+	input.Expand(lastInput);
+	m_IsLastForwardInputSparse = false;
+	ForwardImpl(lastInput, output);
+}
 
 FCLayer::FCLayer(std::size_t inputSize, std::size_t outputSize)
 	: Layer("FCLayer"),
@@ -222,22 +549,23 @@ FCLayer::FCLayer(std::size_t inputSize, std::size_t outputSize)
 	m_Biases(GetParameterTable().AddParameter("Biases", RandomMatrix(outputSize, 1))) {}
 
 std::size_t FCLayer::GetForwardInputSize() const noexcept {
-	return m_Weights.GetValue().GetColumnSize();
+	return m_Weights.GetSize().second;
 }
 std::size_t FCLayer::GetForwardOutputSize() const noexcept {
-	return m_Weights.GetValue().GetRowSize();
+	return m_Weights.GetSize().first;
 }
 
 LayerDump FCLayer::GetDump(const LayerDump& prevLayerDump) const {
 	const std::size_t inputSize = GetForwardInputSize();
 	const std::size_t outputSize = GetForwardOutputSize();
+	const Matrix weightValues = m_Weights.GetExpandedValue();
 	std::vector<std::vector<float>> units;
 
 	for (std::size_t i = 0; i < outputSize; ++i) {
 		std::vector<float>& weights = units.emplace_back();
 
 		for (std::size_t j = 0; j < inputSize; ++j) {
-			weights.push_back(m_Weights.GetValue()(i, j));
+			weights.push_back(weightValues(i, j));
 		}
 	}
 
@@ -255,39 +583,137 @@ void FCLayer::ResetAllParameters() {
 
 	m_Weights.SetValue(RandomMatrix(outputSize, inputSize));
 	m_Biases.SetValue(RandomMatrix(outputSize, 1));
+	m_Weights.SetPrecision(GetPrecision());
+	m_Biases.SetPrecision(GetPrecision());
+	Dequantize();
+}
+
+void FCLayer::Quantize(std::vector<float> inputScales, const ALayer* fusedALayer) {
+	assert(GetPrecision() == MatrixPrecision::Float32);
+	assert(inputScales.size() == GetForwardInputSize());
+
+	// Է äκ  ġ   θ int32  Ŀ ະ ġ ϸ ϸ 
+	Matrix scaledWeights(m_Weights.GetValue());
+
+	for (std::size_t i = 0; i < scaledWeights.GetRowSize(); ++i) {
+		for (std::size_t j = 0; j < scaledWeights.GetColumnSize(); ++j) {
+			scaledWeights(i, j) *= inputScales[j];
+		}
+	}
+
+	m_QuantizedWeights.Assign(scaledWeights);
+	m_InputScales = std::move(inputScales);
+	m_FusedALayer = fusedALayer;
+}
+void FCLayer::Dequantize() noexcept {
+	m_QuantizedWeights = {};
+	m_QuantizedInput = {};
+	m_InputScales.clear();
+	m_FusedALayer = nullptr;
+}
+bool FCLayer::IsQuantized() const noexcept {
+	return !m_QuantizedWeights.IsEmpty();
+}
+float FCLayer::GetFusedLearningRate() const noexcept {
+	return m_FusedLearningRate;
+}
+void FCLayer::SetFusedLearningRate(float newFusedLearningRate) noexcept {
+	assert(newFusedLearningRate >= 0.f);
+
+	m_FusedLearningRate = newFusedLearningRate;
 }
 
-Matrix FCLayer::ForwardImpl(const Matrix& input) {
-	return m_Weights.GetValue() * input + m_Biases.GetValue() * Matrix(1, input.GetColumnSize(), 1);
+void FCLayer::ForwardImpl(const Matrix& input, Matrix& output) {
+	output.Resize(GetForwardOutputSize(), input.GetColumnSize());
+
+	if (IsQuantized()) {
+		m_QuantizedInput.AssignTransposed(input, m_InputScales);
+
+		if (m_FusedALayer) {
+			QuantizedGemm(output, m_QuantizedWeights, m_QuantizedInput, m_Biases.GetValue(), [this](MatrixView block) {
+				m_FusedALayer->Activate(block);
+			});
+		} else {
+			QuantizedGemm(output, m_QuantizedWeights, m_QuantizedInput, m_Biases.GetValue());
+		}
+	} else if (GetPrecision() == MatrixPrecision::Float32) {
+		Gemm(output, m_Weights.GetValue(), input);
+		AddColumnVector(output, m_Biases.GetValue());
+	} else {
+		m_ExpandedBiases.Resize(GetForwardOutputSize(), 1);
+		m_Biases.GetCompactValue().Expand(m_ExpandedBiases);
+
+		Gemm(output, m_Weights.GetCompactValue(), input);
+		AddColumnVector(output, m_ExpandedBiases);
+	}
 }
-Matrix FCLayer::BackwardImpl(const Matrix& input) {
-	m_Weights.SetGradient(input * Transpose(GetLastForwardInput()));
-	m_Biases.SetGradient(input * Matrix(1, GetLastForwardInput().GetColumnSize(), 1));
+void FCLayer::ForwardSparseImpl(const SparseMatrix& input, Matrix& output) {
+	if (IsQuantized() || input.GetFormat() != SparseMatrixFormat::CSC) {
+		Layer::ForwardSparseImpl(input, output);
+
+		return;
+	}
 
-	return Transpose(m_Weights.GetValue()) * input;
+	output.Resize(GetForwardOutputSize(), input.GetColumnSize());
+
+	Gemm(output, m_Weights.GetValue(), input);
+	AddColumnVector(output, m_Biases.GetValue());
+}
+void FCLayer::BackwardImpl(const Matrix& input, Matrix& output) {
+	if (IsQuantized()) throw std::runtime_error("Backward requires a dequantized layer");
+
+	const MatrixView weights = m_Weights.GetValue();
+	const SparseMatrix* const sparseInput = GetLastSparseForwardInput();
+	const std::size_t column = sparseInput ? sparseInput->GetColumnSize() : GetLastForwardInput().GetColumnSize();
+
+	const MatrixView weightsGradient = m_Weights.GetGradient();
+	const MatrixView biasesGradient = m_Biases.GetGradient();
+
+	output.Resize(weights.GetColumnSize(), column);
+
+	SumRows(biasesGradient, input);
+	GemmTransposedLhs(output, weights, input);
+
+	if (m_FusedLearningRate > 0.f) {
+		Axpy(m_Biases.GetValue(), -m_FusedLearningRate, biasesGradient);
+
+		if (sparseInput) {
+			GemmTransposedRhs(weights, input, *sparseInput, -m_FusedLearningRate, 1.f);
+		} else {
+			GemmTransposedRhs(weights, input, GetLastForwardInput(), -m_FusedLearningRate, 1.f);
+		}
+
+		return;
+	}
+
+	if (sparseInput) {
+		GemmTransposedRhs(weightsGradient, input, *sparseInput);
+	} else {
+		GemmTransposedRhs(weightsGradient, input, GetLastForwardInput());
+	}
 }
 
 ALayer::ALayer(AFunction aFunction)
 	: Layer("ALayer"), m_AFunction(aFunction) {
 	switch (aFunction) {
 	case AFunction::Sigmoid:
-		m_Primitive = Sigmoid;
-		m_Derivative = SigmoidDerivative;
+		m_Primitive = ActivateImpl<AFunction::Sigmoid>;
+		m_Derivative = DifferentiateImpl<AFunction::Sigmoid>;
 		break;
 
 	case AFunction::Tanh:
-		m_Primitive = Tanh;
-		m_Derivative = TanhDerivative;
+		m_Primitive = ActivateImpl<AFunction::Tanh>;
+		m_Derivative = DifferentiateImpl<AFunction::Tanh>;
 		break;
 
 	case AFunction::ReLU:
-		m_Primitive = ReLU;
-		m_Derivative = ReLUDerivative;
+		m_Primitive = ActivateImpl<AFunction::ReLU>;
+		m_Derivative = DifferentiateImpl<AFunction::ReLU>;
 		break;
 
 	case AFunction::LeakyReLU:
-		m_Primitive = LeakyReLU;
-		m_Derivative = LeakyReLUDerivative;
+		m_Primitive = ActivateImpl<AFunction::LeakyReLU>;
+		m_Derivative = DifferentiateImpl<AFunction::LeakyReLU>;
 		break;
 
 	default:
@@ -342,34 +768,26 @@ LayerDump ALayer::GetDump(const LayerDump& prevLayerDump) const {
 }
 void ALayer::ResetAllParameters() {}
 
-Matrix ALayer::ForwardImpl(const Matrix& input) {
-	const auto [row, column] = input.GetSize();
-	Matrix result = input;
-
-	for (std::size_t i = 0; i < row; ++i) {
-		for (std::size_t j = 0; j < column; ++j) {
-			result(i, j) = m_Primitive(result(i, j));
-		}
-	}
+void ALayer::ForwardImpl(const Matrix& input, Matrix& output) {
+	output = input;
 
-	return result;
+	Activate(output);
 }
-Matrix ALayer::BackwardImpl(const Matrix& input) {
-	Matrix result = GetLastForwardInput();
-	const auto [row, column] = result.GetSize();
+void ALayer::BackwardImpl(const Matrix& input, Matrix& output) {
+	Matrix& result = output;
 
-	for (std::size_t i = 0; i < row; ++i) {
-		for (std::size_t j = 0; j < column; ++j) {
-			result(i, j) = m_Derivative(result(i, j));
-		}
-	}
+	result = GetLastForwardInput();
 
-	return HadamardProduct(result, input);
+	m_Derivative(result);
+	result.HadamardProduct(input);
 }
 
 AFunction ALayer::GetAFunction() const noexcept {
 	return m_AFunction;
 }
+void ALayer::Activate(MatrixView values) const {
+	m_Primitive(values);
+}
 
 float Sigmoid(float x) {
 	return 1 / (1 + std::expf(-x));
@@ -426,59 +844,104 @@ LayerDump SMLayer::GetDump(const LayerDump& prevLayerDump) const {
 }
 void SMLayer::ResetAllParameters() {}
 
-Matrix SMLayer::ForwardImpl(const Matrix& input) {
+void SMLayer::ForwardImpl(const Matrix& input, Matrix& output) {
+	const ComputeBackend& backend = GetComputeBackend();
 	const auto [row, column] = input.GetSize();
-	Matrix result = input;
-
-	for (std::size_t i = 0; i < column; ++i) {
-		float sum = 0;
+	Matrix& result = output;
 
-		for (std::size_t j = 0; j < row; ++j) {
-			result(j, i) = std::expf(result(j, i));
+	result = input;
 
-			sum += result(j, i);
-		}
+	m_Sums.assign(result.Row(0).GetData(), result.Row(0).GetData() + column);
 
-		for (std::size_t j = 0; j < row; ++j) {
-			result(j, i) /= sum;
-		}
+	for (std::size_t i = 1; i < row; ++i) {
+		backend.Max(column, result.Row(i).GetData(), m_Sums.data());
+	}
+	for (std::size_t i = 0; i < row; ++i) {
+		backend.Subtract(column, m_Sums.data(), result.Row(i).GetData());
 	}
 
-	return result;
+	TransformRows(result, [&backend](std::size_t n, float* y) noexcept {
+		backend.Exp(n, y);
+	});
+
+	m_Sums.assign(result.Row(0).GetData(), result.Row(0).GetData() + column);
+
+	for (std::size_t i = 1; i < row; ++i) {
+		backend.Add(column, result.Row(i).GetData(), m_Sums.data());
+	}
+	for (std::size_t i = 0; i < row; ++i) {
+		backend.Divide(column, m_Sums.data(), result.Row(i).GetData());
+	}
 }
-Matrix SMLayer::BackwardImpl(const Matrix& input) {
+void SMLayer::BackwardImpl(const Matrix& input, Matrix& output) {
+	const ComputeBackend& backend = GetComputeBackend();
 	const Matrix& lastOutput = GetLastForwardOutput();
 	const auto [row, column] = lastOutput.GetSize();
 
-	Matrix result(row, column);
+	Matrix& result = output;
+
+	result = lastOutput;
+	result.HadamardProduct(input);
+
+	m_Sums.resize(column);
+	SumColumns(MatrixView(m_Sums.data(), 1, column, column), result);
+
+	for (std::size_t i = 0; i < row; ++i) {
+		m_Products.assign(lastOutput.Row(i).GetData(), lastOutput.Row(i).GetData() + column);
+
+		backend.Multiply(column, m_Sums.data(), m_Products.data());
+		backend.Subtract(column, m_Products.data(), result.Row(i).GetData());
+	}
+}
+float SMLayer::ForwardCrossEntropy(const Matrix& target) const {
+	// Ȯ α׸ ϸ ÷ Ȯ -inf ǹǷ  log-sum-exp 
+	const Matrix logits = GetVariableTable().GetVariable("LastForwardInput").GetExpandedValue();
+	const auto [row, column] = logits.GetSize();
+
+	assert(target.GetSize() == logits.GetSize());
+
+	float result = 0;
 
 	for (std::size_t i = 0; i < column; ++i) {
-		Matrix gradient(row, row);
+		float maxLogit = logits(0, i);
 
-		for (std::size_t j = 0; j < row; ++j) {
-			for (std::size_t k = 0; k < row; ++k) {
-				if (j == k) {
-					gradient(j, k) = lastOutput(j, i) * (1 - lastOutput(j, i));
-				} else {
-					gradient(j, k) = -lastOutput(j, i) * lastOutput(k, i);
-				}
-			}
+		for (std::size_t j = 1; j < row; ++j) {
+			maxLogit = std::max(maxLogit, logits(j, i));
 		}
 
-		Matrix oneInput(row, 1);
+		float expSum = 0;
 
 		for (std::size_t j = 0; j < row; ++j) {
-			oneInput(j, 0) = input(j, i);
+			expSum += std::exp(logits(j, i) - maxLogit);
 		}
 
-		const Matrix oneResult = gradient * oneInput;
+		const float logSumExp = maxLogit + std::log(expSum);
 
 		for (std::size_t j = 0; j < row; ++j) {
-			result(j, i) = oneResult(j, 0);
+			result += target(j, i) * (logits(j, i) - logSumExp);
 		}
 	}
 
-	return result;
+	return result / column;
+}
+void SMLayer::BackwardCrossEntropy(const Matrix& target, Matrix& output) {
+	const ComputeBackend& backend = GetComputeBackend();
+	const Matrix& lastOutput = GetLastForwardOutput();
+	const auto [row, column] = lastOutput.GetSize();
+
+	assert(target.GetSize() == lastOutput.GetSize());
+
+	m_Sums.resize(column);
+	SumColumns(MatrixView(m_Sums.data(), 1, column, column), target);
+
+	output = lastOutput;
+
+	for (std::size_t i = 0; i < row; ++i) {
+		backend.Multiply(column, m_Sums.data(), output.Row(i).GetData());
+		backend.Subtract(column, target.Row(i).GetData(), output.Row(i).GetData());
+	}
+
+	output *= 1.f / column;
 }
 
 LayerDump::LayerDump(std::size_t inputSize)
@@ -7,7 +7,6 @@
 #include <memory>
 #include <string>
 #include <string_view>
-#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -17,10 +16,10 @@ class Variable final {
 	friend class ReadonlyVariable;
 
 private:
-	std::map<std::string, Matrix>::iterator m_Iterator;
+	std::map<std::string, std::pair<Matrix, CompactMatrix>>::iterator m_Iterator;
 
 public:
-	Variable(std::map<std::string, Matrix>::iterator iterator) noexcept;
+	Variable(std::map<std::string, std::pair<Matrix, CompactMatrix>>::iterator iterator) noexcept;
 	Variable(const Variable& other) noexcept = default;
 	~Variable() = default;
 
@@ -32,14 +31,19 @@ public:
 	std::string_view GetName() const noexcept;
 	Matrix& GetValue() const noexcept;
 	Matrix& SetValue(Matrix newValue) const noexcept;
+	CompactMatrix& GetCompactValue() const noexcept;
+	CompactMatrix& SetCompactValue(ConstMatrixView newValue, MatrixPrecision precision) const;
+	Matrix GetExpandedValue() const;
+	MatrixPrecision GetPrecision() const noexcept;
+	void SetPrecision(MatrixPrecision newPrecision) const;
 };
 
 class ReadonlyVariable final {
 private:
-	std::map<std::string, Matrix>::const_iterator m_Iterator;
+	std::map<std::string, std::pair<Matrix, CompactMatrix>>::const_iterator m_Iterator;
 
 public:
-	ReadonlyVariable(std::map<std::string, Matrix>::const_iterator iterator) noexcept;
+	ReadonlyVariable(std::map<std::string, std::pair<Matrix, CompactMatrix>>::const_iterator iterator) noexcept;
 	ReadonlyVariable(const Variable& variable) noexcept;
 	ReadonlyVariable(const ReadonlyVariable& other) noexcept = default;
 	~ReadonlyVariable() = default;
@@ -53,11 +57,14 @@ public:
 public:
 	std::string_view GetName() const noexcept;
 	const Matrix& GetValue() const noexcept;
+	const CompactMatrix& GetCompactValue() const noexcept;
+	Matrix GetExpandedValue() const;
+	MatrixPrecision GetPrecision() const noexcept;
 };
 
 class VariableTable final {
 private:
-	std::map<std::string, Matrix> m_Variables;
+	std::map<std::string, std::pair<Matrix, CompactMatrix>> m_Variables;
 
 public:
 	VariableTable() = default;
@@ -75,18 +82,28 @@ public:
 	Variable AddVariable(std::string name, Matrix initialValue = {});
 };
 
+class ParameterTable;
+class ParameterArena;
+
+struct ParameterEntry final {
+	std::size_t RowSize = 0, ColumnSize = 0;
+	std::size_t Offset = 0, Stride = 0;
+	bool HasStorage = false;
+	std::unique_ptr<VariableTable> Variables = std::make_unique<VariableTable>();
+	CompactMatrix CompactValue;
+};
+
 class ReadonlyParameter;
 
 class Parameter final {
 	friend class ReadonlyParameter;
 
 private:
-	std::map<std::string,
-		std::tuple<Matrix, Matrix, std::unique_ptr<VariableTable>>>::iterator m_Iterator;
+	ParameterTable* m_Table;
+	std::map<std::string, ParameterEntry>::iterator m_Iterator;
 
 public:
-	Parameter(std::map<std::string,
-		std::tuple<Matrix, Matrix, std::unique_ptr<VariableTable>>>::iterator iterator) noexcept;
+	Parameter(ParameterTable& table, std::map<std::string, ParameterEntry>::iterator iterator) noexcept;
 	Parameter(const Parameter& other) noexcept = default;
 	~Parameter() = default;
 
@@ -96,21 +113,25 @@ public:
 
 public:
 	std::string_view GetName() const noexcept;
-	Matrix& GetValue() const noexcept;
-	Matrix& SetValue(Matrix newValue) const noexcept;
-	Matrix& GetGradient() const noexcept;
-	Matrix& SetGradient(Matrix newGradient) const noexcept;
+	MatrixView GetValue() const noexcept;
+	MatrixView SetValue(ConstMatrixView newValue) const;
+	MatrixView GetGradient() const noexcept;
+	MatrixView SetGradient(ConstMatrixView newGradient) const noexcept;
 	VariableTable& GetVariableTable() const noexcept;
+	const CompactMatrix& GetCompactValue() const noexcept;
+	Matrix GetExpandedValue() const;
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
+	MatrixPrecision GetPrecision() const noexcept;
+	void SetPrecision(MatrixPrecision newPrecision) const;
 };
 
 class ReadonlyParameter final {
 private:
-	std::map<std::string,
-		std::tuple<Matrix, Matrix, std::unique_ptr<VariableTable>>>::const_iterator m_Iterator;
+	const ParameterTable* m_Table;
+	std::map<std::string, ParameterEntry>::const_iterator m_Iterator;
 
 public:
-	ReadonlyParameter(std::map<std::string,
-		std::tuple<Matrix, Matrix, std::unique_ptr<VariableTable>>>::const_iterator iterator) noexcept;
+	ReadonlyParameter(const ParameterTable& table, std::map<std::string, ParameterEntry>::const_iterator iterator) noexcept;
 	ReadonlyParameter(const Parameter& parameter) noexcept;
 	ReadonlyParameter(const ReadonlyParameter& other) noexcept = default;
 	~ReadonlyParameter() = default;
@@ -123,14 +144,23 @@ public:
 
 public:
 	std::string_view GetName() const noexcept;
-	const Matrix& GetValue() const noexcept;
-	const Matrix& GetGradient() const noexcept;
+	ConstMatrixView GetValue() const noexcept;
+	ConstMatrixView GetGradient() const noexcept;
 	const VariableTable& GetVariableTable() const noexcept;
+	const CompactMatrix& GetCompactValue() const noexcept;
+	Matrix GetExpandedValue() const;
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
+	MatrixPrecision GetPrecision() const noexcept;
 };
 
 class ParameterTable final {
+	friend class Parameter;
+	friend class ReadonlyParameter;
+	friend class ParameterArena;
+
 private:
-	std::map<std::string, std::tuple<Matrix, Matrix, std::unique_ptr<VariableTable>>> m_Parameters;
+	std::map<std::string, ParameterEntry> m_Parameters;
+	std::shared_ptr<ParameterArena> m_Arena;
 
 public:
 	ParameterTable() = default;
@@ -145,7 +175,37 @@ public:
 	Parameter GetParameter(const std::string& name) noexcept;
 	std::vector<ReadonlyParameter> GetAllParameters() const;
 	std::vector<Parameter> GetAllParameters();
-	Parameter AddParameter(std::string name, Matrix initialValue = {});
+	Parameter AddParameter(std::string name, ConstMatrixView initialValue = {});
+
+private:
+	ConstMatrixView GetValue(const ParameterEntry& entry) const noexcept;
+	MatrixView GetValue(const ParameterEntry& entry) noexcept;
+	ConstMatrixView GetGradient(const ParameterEntry& entry) const noexcept;
+	MatrixView GetGradient(const ParameterEntry& entry) noexcept;
+};
+
+class ParameterArena final {
+private:
+	std::vector<const ParameterTable*> m_Tables;
+	MatrixStorage<float> m_Elements;
+	std::size_t m_Size = 0;
+
+public:
+	ParameterArena() noexcept = default;
+	ParameterArena(const ParameterArena&) = delete;
+	~ParameterArena() = default;
+
+public:
+	ParameterArena& operator=(const ParameterArena&) = delete;
+
+public:
+	static std::shared_ptr<ParameterArena> Assign(const std::vector<ParameterTable*>& parameterTables);
+	bool IsAssigned(const std::vector<ParameterTable*>& parameterTables) const noexcept;
+	std::size_t GetSize() const noexcept;
+	ConstMatrixView GetValues() const noexcept;
+	MatrixView GetValues() noexcept;
+	ConstMatrixView GetGradients() const noexcept;
+	MatrixView GetGradients() noexcept;
 };
 
 class LayerDump;
@@ -155,9 +215,13 @@ private:
 	std::string m_Name;
 	VariableTable m_VariableTable;
 	ParameterTable m_ParameterTable;
+	MatrixPrecision m_Precision = MatrixPrecision::Float32;
 
 	Variable m_LastForwardInput, m_LastForwardOutput;
 	Variable m_LastBackwardInput, m_LastBackwardOutput;
+	SparseMatrix m_LastSparseForwardInput;
+	bool m_IsLastForwardInputSparse = false;
+	Matrix m_CompactForwardOutput;
 
 public:
 	Layer(std::string name);
@@ -170,13 +234,15 @@ public:
 public:
 	std::string_view GetName() const noexcept;
 
-	Matrix Forward(const Matrix& input);
+	const Matrix& Forward(const Matrix& input);
+	const Matrix& Forward(const SparseMatrix& input);
 	const Matrix& GetLastForwardInput() const noexcept;
+	const SparseMatrix* GetLastSparseForwardInput() const noexcept;
 	const Matrix& GetLastForwardOutput() const noexcept;
 	virtual std::size_t GetForwardInputSize() const noexcept = 0;
 	virtual std::size_t GetForwardOutputSize() const noexcept = 0;
 
-	Matrix Backward(const Matrix& input);
+	const Matrix& Backward(const Matrix& input);
 	const Matrix& GetLastBackwardInput() const noexcept;
 	const Matrix& GetLastBackwardOutput() const noexcept;
 
@@ -184,18 +250,29 @@ public:
 	VariableTable& GetVariableTable() noexcept;
 	const ParameterTable& GetParameterTable() const noexcept;
 	ParameterTable& GetParameterTable() noexcept;
+	MatrixPrecision GetPrecision() const noexcept;
+	void SetPrecision(MatrixPrecision newPrecision);
 
 	virtual LayerDump GetDump(const LayerDump& prevLayerDump) const = 0;
 	virtual void ResetAllParameters() = 0;
 
 protected:
-	virtual Matrix ForwardImpl(const Matrix& input) = 0;
-	virtual Matrix BackwardImpl(const Matrix& input) = 0;
+	virtual void ForwardImpl(const Matrix& input, Matrix& output) = 0;
+	virtual void ForwardSparseImpl(const SparseMatrix& input, Matrix& output);
+	virtual void BackwardImpl(const Matrix& input, Matrix& output) = 0;
 };
 
+class ALayer;
+
 class FCLayer final : public Layer {
 private:
 	Parameter m_Weights, m_Biases;
+	Matrix m_ExpandedBiases;
+
+	QuantizedMatrix m_QuantizedWeights, m_QuantizedInput;
+	std::vector<float> m_InputScales;
+	const ALayer* m_FusedALayer = nullptr;
+	float m_FusedLearningRate = 0.f;
 
 public:
 	FCLayer(std::size_t inputSize, std::size_t outputSize);
@@ -212,9 +289,16 @@ public:
 	virtual LayerDump GetDump(const LayerDump& prevLayerDump) const override;
 	virtual void ResetAllParameters() override;
 
+	void Quantize(std::vector<float> inputScales, const ALayer* fusedALayer);
+	void Dequantize() noexcept;
+	bool IsQuantized() const noexcept;
+	float GetFusedLearningRate() const noexcept;
+	void SetFusedLearningRate(float newFusedLearningRate) noexcept;
+
 protected:
-	virtual Matrix ForwardImpl(const Matrix& input) override;
-	virtual Matrix BackwardImpl(const Matrix& input) override;
+	virtual void ForwardImpl(const Matrix& input, Matrix& output) override;
+	virtual void ForwardSparseImpl(const SparseMatrix& input, Matrix& output) override;
+	virtual void BackwardImpl(const Matrix& input, Matrix& output) override;
 };
 
 enum class AFunction {
@@ -227,8 +311,8 @@ enum class AFunction {
 class ALayer final : public Layer {
 private:
 	AFunction m_AFunction;
-	float (*m_Primitive)(float) = nullptr;
-	float (*m_Derivative)(float) = nullptr;
+	void (*m_Primitive)(MatrixView) noexcept = nullptr;
+	void (*m_Derivative)(MatrixView) noexcept = nullptr;
 
 public:
 	ALayer(AFunction aFunction);
@@ -246,11 +330,12 @@ public:
 	virtual void ResetAllParameters() override;
 
 protected:
-	virtual Matrix ForwardImpl(const Matrix& input) override;
-	virtual Matrix BackwardImpl(const Matrix& input) override;
+	virtual void ForwardImpl(const Matrix& input, Matrix& output) override;
+	virtual void BackwardImpl(const Matrix& input, Matrix& output) override;
 
 public:
 	AFunction GetAFunction() const noexcept;
+	void Activate(MatrixView values) const;
 };
 
 float Sigmoid(float x);
@@ -263,6 +348,9 @@ float LeakyReLU(float x);
 float LeakyReLUDerivative(float x);
 
 class SMLayer final : public Layer {
+private:
+	std::vector<float> m_Sums, m_Products;
+
 public:
 	SMLayer();
 	SMLayer(const SMLayer&) = delete;
@@ -278,9 +366,12 @@ public:
 	virtual LayerDump GetDump(const LayerDump& prevLayerDump) const override;
 	virtual void ResetAllParameters() override;
 
+	float ForwardCrossEntropy(const Matrix& target) const;
+	void BackwardCrossEntropy(const Matrix& target, Matrix& output);
+
 protected:
-	virtual Matrix ForwardImpl(const Matrix& input) override;
-	virtual Matrix BackwardImpl(const Matrix& input) override;
+	virtual void ForwardImpl(const Matrix& input, Matrix& output) override;
+	virtual void BackwardImpl(const Matrix& input, Matrix& output) override;
 };
 
 class LayerDump final {
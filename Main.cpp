@@ -1,3 +1,4 @@
+#include "GemmTuner.hpp"
 #include "MainWindow.hpp"
 #include "Optimizer.hpp"
 #include "PALGraphics.hpp"
@@ -16,6 +17,7 @@ static int Run() {
 }
 
 int Main() {
+	LoadGemmTuningCache(GetGemmTuningCachePath());
 	InitializeGraphics();
 
 	const int result = Run();
@@ -1,39 +1,54 @@
 #include "MainWindow.hpp"
 
 #include "Application.hpp"
+#include "GemmTuner.hpp"
 #include "InputDialog.hpp"
 #include "Layer.hpp"
 #include "Matrix.hpp"
 #include "NetworkViewer.hpp"
 #include "Optimizer.hpp"
 #include "PALNetwork.hpp"
+#include "Random.hpp"
 
 #include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <iomanip>
 #include <istream>
+#include <limits>
 #include <ostream>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #define SAM_DONETEST 0
 #define SAM_DONEFASTOPTIMIZING 1
 #define SAM_DONEOPTIMIZING 2
+#define SAM_DONEQUANTIZING 3
+#define SAM_DONETUNING 4
 
 namespace {
+	template<typename M>
 	void PrintInputOrOutput(std::ostream& stream, const char* title,
-		std::size_t index, const Matrix& matrix) {
+		std::size_t index, const M& matrix) {
 		stream << title << " #" << index << ": [";
 		for (std::size_t i = 0; i < matrix.GetRowSize(); ++i) {
 			stream << " " << matrix(i, 0);
 		}
 		stream << " ]";
 	}
+	void PrintInputOrOutput(std::ostream& stream, const char* title,
+		std::size_t index, const TrainInput& input) {
+		std::visit([&](const auto& matrix) {
+			PrintInputOrOutput(stream, title, index, matrix);
+		}, input);
+	}
 	std::optional<TrainData> ReadTrainDataFromStream(Window& window, std::istream& stream,
 		std::size_t inputSize, std::size_t outputSize) {
 		std::vector<float> numbers;
@@ -72,7 +87,7 @@ namespace {
 
 		for (std::size_t i = 0; i < sampleCount; ++i) {
 			TrainSample& trainSample = trainData.emplace_back();
-			Matrix& input = trainSample.first;
+			Matrix& input = trainSample.first.emplace<Matrix>();
 			Matrix& output = trainSample.second;
 
 			input = Matrix(inputSize, 1);
@@ -126,6 +141,8 @@ private:
 	std::size_t prevLossFunctionNameComboBoxIndex = ComboBox::NoSelected;
 
 	TextBox* m_LearningRateTextBox = nullptr;
+	TextBox* m_BatchSizeTextBox = nullptr;
+	TextBox* m_AccumulationStepCountTextBox = nullptr;
 
 	Network& m_Network;
 	bool m_IsOptimzierEdited = false;
@@ -314,6 +331,56 @@ public:
 
 		m_LearningRateTextBox->SetLocation(10, 10 + (20 + 24 * 2));
 
+		class BatchSizeTextBoxHandler final : public TextBoxEventHandler {
+		private:
+			WindowDialog& m_WindowDialog;
+
+		public:
+			BatchSizeTextBoxHandler(WindowDialog& windowDialog) noexcept
+				: m_WindowDialog(windowDialog) {}
+			BatchSizeTextBoxHandler(const BatchSizeTextBoxHandler&) = delete;
+			virtual ~BatchSizeTextBoxHandler() override = default;
+
+		public:
+			BatchSizeTextBoxHandler& operator=(const BatchSizeTextBoxHandler&) = delete;
+
+		public:
+			virtual void OnTextChanged(TextBox&) override {
+				dynamic_cast<OptimizerOptionDialogHandler&>(
+					m_WindowDialog.GetEventHandler()).OnBatchSizeTextBoxTextChanged();
+			}
+		};
+
+		m_BatchSizeTextBox = &dynamic_cast<TextBox&>(dialog.AddChild(
+			TextBoxRef(std::make_unique<BatchSizeTextBoxHandler>(*m_WindowDialog))));
+
+		m_BatchSizeTextBox->SetLocation(10, 10 + (30 + 24 * 3));
+
+		class AccumulationStepCountTextBoxHandler final : public TextBoxEventHandler {
+		private:
+			WindowDialog& m_WindowDialog;
+
+		public:
+			AccumulationStepCountTextBoxHandler(WindowDialog& windowDialog) noexcept
+				: m_WindowDialog(windowDialog) {}
+			AccumulationStepCountTextBoxHandler(const AccumulationStepCountTextBoxHandler&) = delete;
+			virtual ~AccumulationStepCountTextBoxHandler() override = default;
+
+		public:
+			AccumulationStepCountTextBoxHandler& operator=(const AccumulationStepCountTextBoxHandler&) = delete;
+
+		public:
+			virtual void OnTextChanged(TextBox&) override {
+				dynamic_cast<OptimizerOptionDialogHandler&>(
+					m_WindowDialog.GetEventHandler()).OnAccumulationStepCountTextBoxTextChanged();
+			}
+		};
+
+		m_AccumulationStepCountTextBox = &dynamic_cast<TextBox&>(dialog.AddChild(
+			TextBoxRef(std::make_unique<AccumulationStepCountTextBoxHandler>(*m_WindowDialog))));
+
+		m_AccumulationStepCountTextBox->SetLocation(10, 10 + (40 + 24 * 4));
+
 		m_WindowDialog->SetMinimumSize(400, 160);
 
 		if (m_Network.HasOptimizer()) {
@@ -365,6 +432,8 @@ public:
 			m_CancelButton->SetSize(82, 24);
 
 			m_LearningRateTextBox->SetSize(clientWidth - 20, 24);
+			m_BatchSizeTextBox->SetSize(clientWidth - 20, 24);
+			m_AccumulationStepCountTextBox->SetSize(clientWidth - 20, 24);
 		}
 	}
 
@@ -380,7 +449,13 @@ public:
 			m_LearningRateTextBox->SetText(std::to_string(m_SGDOptimizer->GetLearningRate()));
 			m_LearningRateTextBox->Show();
 
-			m_WindowDialog->SetMinimumSize(400, 190);
+			m_BatchSizeTextBox->SetText(std::to_string(m_SGDOptimizer->GetBatchSize()));
+			m_BatchSizeTextBox->Show();
+
+			m_AccumulationStepCountTextBox->SetText(std::to_string(m_SGDOptimizer->GetAccumulationStepCount()));
+			m_AccumulationStepCountTextBox->Show();
+
+			m_WindowDialog->SetMinimumSize(400, 258);
 		}
 
 		prevOptimizerNameComboBoxIndex = index;
@@ -406,6 +481,12 @@ public:
 	void OnLearningRateTextBoxTextChanged() {
 		m_ApplyButton->SetEnabled(true);
 	}
+	void OnBatchSizeTextBoxTextChanged() {
+		m_ApplyButton->SetEnabled(true);
+	}
+	void OnAccumulationStepCountTextBoxTextChanged() {
+		m_ApplyButton->SetEnabled(true);
+	}
 
 	void OnOkButtonClick() {
 		if (!m_ApplyButton->GetEnabled() || OnApplyButtonClick()) {
@@ -426,7 +507,17 @@ public:
 
 			if (!learningRate) return false;
 
+			const auto batchSize = GetBatchSize();
+
+			if (!batchSize) return false;
+
+			const auto accumulationStepCount = GetAccumulationStepCount();
+
+			if (!accumulationStepCount) return false;
+
 			m_SGDOptimizer->SetLearningRate(*learningRate);
+			m_SGDOptimizer->SetBatchSize(*batchSize);
+			m_SGDOptimizer->SetAccumulationStepCount(*accumulationStepCount);
 			m_Network.SetOptimizer(m_SGDOptimizer->Copy());
 
 			break;
@@ -468,6 +559,36 @@ private:
 			return std::nullopt;
 		} else return learningRate;
 	}
+	std::optional<std::size_t> GetBatchSize() {
+		return GetCount(*m_BatchSizeTextBox, "ġ ũ");
+	}
+	std::optional<std::size_t> GetAccumulationStepCount() {
+		return GetCount(*m_AccumulationStepCountTextBox, " ܰ ");
+	}
+	std::optional<std::size_t> GetCount(TextBox& textBox, const std::string& name) {
+		std::istringstream iss(textBox.GetText() + ' ');
+
+		long long count;
+		iss >> count;
+
+		if (iss.eof()) {
+			MessageDialogRef messageDialog(m_WindowDialog->GetWindow(), SAM_APPNAME, "ùٸ  Դϴ",
+				name + " Էߴ Ȯ .",
+				MessageDialog::Error, MessageDialog::Ok);
+
+			messageDialog->Show();
+
+			return std::nullopt;
+		} else if (iss.fail() || iss.bad() || count <= 0 || count > std::numeric_limits<std::int32_t>::max()) {
+			MessageDialogRef messageDialog(m_WindowDialog->GetWindow(), SAM_APPNAME, "ùٸ  Դϴ",
+				name + " 1 ̻ " + std::to_string(std::numeric_limits<std::int32_t>::max()) + "   Ȯ .",
+				MessageDialog::Error, MessageDialog::Ok);
+
+			messageDialog->Show();
+
+			return std::nullopt;
+		} else return static_cast<std::size_t>(count);
+	}
 };
 
 void MainWindowHandler::OnCreate(Control& control) {
@@ -525,6 +646,16 @@ void MainWindowHandler::OnReceiveMessage(Control&, std::size_t message, std::opt
 			DoneOptimizingOperation();
 		}
 
+		break;
+
+	case SAM_DONEQUANTIZING:
+		DoneQuantizingOperation();
+
+		break;
+
+	case SAM_DONETUNING:
+		DoneTuningOperation(std::any_cast<bool>(*argument));
+
 		break;
 	}
 }
@@ -579,6 +710,8 @@ MenuRef MainWindowHandler::CreateMenu() {
 				m_Project = std::move(newProject);
 				m_IsSaved = true;
 
+				SetRandomSeed(m_Project->GetSeed());
+
 				UpdateText();
 
 				dynamic_cast<NetworkViewerHandler&>(m_NetworkViewer->GetEventHandler()).
@@ -647,7 +780,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 
 					for (std::size_t i = 0; i < trainData->size(); ++i) {
 						const Matrix output = network.Forward((*trainData)[i].first);
-						const float loss = lossFunction->Forward(output, (*trainData)[i].second);
+						const float loss = network.GetOptimizer().ComputeLoss(output, (*trainData)[i].second);
 
 						lossSum += loss;
 					}
@@ -660,7 +793,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 						}
 
 						const Matrix output = network.Forward((*trainData)[i].first);
-						const float loss = lossFunction->Forward(output, (*trainData)[i].second);
+						const float loss = network.GetOptimizer().ComputeLoss(output, (*trainData)[i].second);
 
 						PrintInputOrOutput(resultOss, "Է", i, (*trainData)[i].first);
 						resultOss << '\n';
@@ -680,6 +813,8 @@ MenuRef MainWindowHandler::CreateMenu() {
 	network->AddSubItem(MenuItemSeparatorRef());
 	network->AddSubItem(MenuItemRef(" н", std::make_unique<FunctionalMenuItemEventHandler>(
 		[&](MenuItem&) {
+			if (!CheckTrainable()) return;
+
 			const auto trainData = AskTrainData("н  Է -  н", "TrainData.txt");
 
 			if (!trainData) return;
@@ -701,7 +836,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 
 				for (const auto& [input, answer] : *trainData) {
 					Matrix output = network.Forward(input);
-					const float loss = lossFunction->Forward(output, answer);
+					const float loss = network.GetOptimizer().ComputeLoss(output, answer);
 
 					befores.push_back(std::make_pair(std::move(output), loss));
 
@@ -724,7 +859,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 
 					for (std::size_t i = 0; i < trainData->size(); ++i) {
 						const Matrix output = network.Forward((*trainData)[i].first);
-						const float loss = lossFunction->Forward(output, (*trainData)[i].second);
+						const float loss = network.GetOptimizer().ComputeLoss(output, (*trainData)[i].second);
 
 						lossSum += loss;
 					}
@@ -738,7 +873,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 						}
 
 						const Matrix output = network.Forward((*trainData)[i].first);
-						const float loss = lossFunction->Forward(output, (*trainData)[i].second);
+						const float loss = network.GetOptimizer().ComputeLoss(output, (*trainData)[i].second);
 
 						PrintInputOrOutput(resultOss, "Է", i, (*trainData)[i].first);
 						resultOss << '\n';
@@ -761,6 +896,8 @@ MenuRef MainWindowHandler::CreateMenu() {
 		})));
 	network->AddSubItem(MenuItemRef("н  ðȭ", std::make_unique<FunctionalMenuItemEventHandler>(
 		[&](MenuItem&) {
+			if (!CheckTrainable()) return;
+
 			const auto trainData = AskTrainData("н  Է - н  ðȭ", "TrainData.txt");
 
 			if (!trainData) return;
@@ -782,7 +919,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 
 				for (const auto& [input, answer] : *trainData) {
 					Matrix output = network.Forward(input);
-					const float loss = lossFunction->Forward(output, answer);
+					const float loss = network.GetOptimizer().ComputeLoss(output, answer);
 
 					befores.push_back(std::make_pair(std::move(output), loss));
 
@@ -815,7 +952,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 
 					for (std::size_t i = 0; i < trainData->size(); ++i) {
 						const Matrix output = network.Forward((*trainData)[i].first);
-						const float loss = lossFunction->Forward(output, (*trainData)[i].second);
+						const float loss = network.GetOptimizer().ComputeLoss(output, (*trainData)[i].second);
 
 						lossSum += loss;
 					}
@@ -829,7 +966,7 @@ MenuRef MainWindowHandler::CreateMenu() {
 						}
 
 						const Matrix output = network.Forward((*trainData)[i].first);
-						const float loss = lossFunction->Forward(output, (*trainData)[i].second);
+						const float loss = network.GetOptimizer().ComputeLoss(output, (*trainData)[i].second);
 
 						PrintInputOrOutput(resultOss, "Է", i, (*trainData)[i].first);
 						resultOss << '\n';
@@ -877,6 +1014,85 @@ MenuRef MainWindowHandler::CreateMenu() {
 			UpdateNetworkViewer();
 		})));
 
+	network->AddSubItem(MenuItemSeparatorRef());
+	network->AddSubItem(MenuItemRef("FP32 е ", std::make_unique<FunctionalMenuItemEventHandler>(
+		[&](MenuItem&) {
+			m_Project->GetNetwork().SetPrecision(MatrixPrecision::Float32);
+
+			m_IsSaved = false;
+
+			UpdateText();
+
+			UpdateNetworkViewer();
+		})));
+	network->AddSubItem(MenuItemRef("BF16 е ", std::make_unique<FunctionalMenuItemEventHandler>(
+		[&](MenuItem&) {
+			m_Project->GetNetwork().SetPrecision(MatrixPrecision::BFloat16);
+
+			m_IsSaved = false;
+
+			UpdateText();
+
+			UpdateNetworkViewer();
+		})));
+	network->AddSubItem(MenuItemRef("FP16 е ", std::make_unique<FunctionalMenuItemEventHandler>(
+		[&](MenuItem&) {
+			m_Project->GetNetwork().SetPrecision(MatrixPrecision::Float16);
+
+			m_IsSaved = false;
+
+			UpdateText();
+
+			UpdateNetworkViewer();
+		})));
+	network->AddSubItem(MenuItemRef("INT8 ȭ", std::make_unique<FunctionalMenuItemEventHandler>(
+		[&](MenuItem&) {
+			if (m_Project->GetNetwork().GetPrecision() != MatrixPrecision::Float32) {
+				MessageDialog::Show(*m_Window, SAM_APPNAME, "ȭ   еԴϴ",
+					"ȭϱ  Ʈũ FP32 е  ּ.", MessageDialog::Error, MessageDialog::Ok);
+
+				return;
+			}
+
+			const auto trainData = AskTrainData("  Է - INT8 ȭ", "TrainData.txt");
+
+			if (!trainData) return;
+
+			StartOperation();
+
+			m_Thread = std::jthread([=]() {
+				m_Project->GetNetwork().Quantize(*trainData);
+
+				m_Window->SendMessage(SAM_DONEQUANTIZING);
+			});
+		})));
+	network->AddSubItem(MenuItemRef("INT8 ȭ ", std::make_unique<FunctionalMenuItemEventHandler>(
+		[&](MenuItem&) {
+			m_Project->GetNetwork().Dequantize();
+		})));
+
+	network->AddSubItem(MenuItemSeparatorRef());
+	network->AddSubItem(MenuItemRef("   Ʃ", std::make_unique<FunctionalMenuItemEventHandler>(
+		[&](MenuItem&) {
+			StartOperation();
+
+			m_Thread = std::jthread([=]() {
+				const GemmParameters gemmParameters = TuneGemmParameters();
+
+				SetGemmParameters(gemmParameters);
+
+				bool isCacheSaved = true;
+
+				try {
+					SaveGemmTuningCache(GetGemmTuningCachePath(), gemmParameters);
+				} catch (const std::runtime_error&) {
+					isCacheSaved = false;
+				}
+
+				m_Window->SendMessage(SAM_DONETUNING, isCacheSaved);
+			});
+		})));
+
 	network->AddSubItem(MenuItemSeparatorRef());
 	network->AddSubItem(MenuItemRef(" ߰", std::make_unique<FunctionalMenuItemEventHandler>(
 		[&](MenuItem&) {
@@ -1064,6 +1280,8 @@ void MainWindowHandler::CreateNewProject() {
 	m_Project = std::make_unique<Project>();
 	m_Project->SetName(" ");
 
+	SetRandomSeed(m_Project->GetSeed());
+
 	m_IsSaved = true;
 
 	UpdateText();
@@ -1102,6 +1320,16 @@ bool MainWindowHandler::SaveProject(bool saveAs) {
 	}
 }
 
+bool MainWindowHandler::CheckTrainable() {
+	if (m_Project->GetNetwork().GetPrecision() != MatrixPrecision::Float32) {
+		MessageDialog::Show(*m_Window, SAM_APPNAME, "н   еԴϴ",
+			"нϱ  Ʈũ FP32 е  ּ.", MessageDialog::Error, MessageDialog::Ok);
+
+		return false;
+	}
+
+	return true;
+}
 std::optional<TrainData> MainWindowHandler::AskTrainData(std::string dialogTitle, const std::filesystem::path& path) {
 	if (!m_Project->GetNetwork().HasOptimizer()) {
 		MessageDialog::Show(*m_Window, SAM_APPNAME, "Ƽ ϴ",
@@ -1267,6 +1495,32 @@ void MainWindowHandler::DoneFastOptimizingOperation(std::string result) {
 	MessageDialog::Show(*m_Window, SAM_APPNAME, "н ", std::move(result),
 		MessageDialog::Information, MessageDialog::Ok);
 }
+void MainWindowHandler::DoneQuantizingOperation() {
+	m_ProjectMenu->SetEnabled(true);
+	m_NetworkMenu->SetEnabled(true);
+
+	MessageDialog::Show(*m_Window, SAM_APPNAME, "ȭ ",
+		" ͷ Է äκ    INT8 ȭ߽ϴ.",
+		MessageDialog::Information, MessageDialog::Ok);
+}
+void MainWindowHandler::DoneTuningOperation(bool isCacheSaved) {
+	m_ProjectMenu->SetEnabled(true);
+	m_NetworkMenu->SetEnabled(true);
+
+	if (!isCacheSaved && !m_HasReportedTuningCacheError) {
+		m_HasReportedTuningCacheError = true;
+
+		MessageDialog::Show(*m_Window, SAM_APPNAME, "Ʃ   ߽ϴ",
+			"Ʃ  ̹ ࿡ Ǹ,  ࿡  ʽϴ.",
+			MessageDialog::Warning, MessageDialog::Ok);
+
+		return;
+	}
+
+	MessageDialog::Show(*m_Window, SAM_APPNAME, "Ʃ ",
+		" ǻͿ °   Ķ͸ Ʃ߽ϴ.",
+		MessageDialog::Information, MessageDialog::Ok);
+}
 void MainWindowHandler::DoneOptimizingOperation() {
 	UpdateNetworkViewer(); // TODO: NetworkDump ޾ƿ 
 }
@@ -27,6 +27,7 @@ private:
 
 	std::optional<std::jthread> m_Thread;
 	bool m_IsFileMode = false;
+	bool m_HasReportedTuningCacheError = false;
 
 public:
 	MainWindowHandler() noexcept = default;
@@ -52,6 +53,7 @@ private:
 	void CreateNewProject();
 	bool SaveProject(bool saveAs = false);
 
+	bool CheckTrainable();
 	std::optional<TrainData> AskTrainData(std::string dialogTitle, const std::filesystem::path& path = "");
 	std::optional<float> AskLearningRate(std::string dialogTitle);
 	std::optional<std::size_t> AskEpoch(std::string dialogTitle);
@@ -61,6 +63,8 @@ private:
 	void DoneOperation();
 	void DoneTestOperation(std::string result);
 	void DoneFastOptimizingOperation(std::string result);
+	void DoneQuantizingOperation();
+	void DoneTuningOperation(bool isCacheSaved);
 	void DoneOptimizingOperation();
 	void DoneOptimizingOperation(std::string result);
 };
\ No newline at end of file
@@ -1,147 +1,755 @@
 #include "Matrix.hpp"
 
+#include "ComputeBackend.hpp"
+#include "MatrixKernel.hpp"
+#include "Random.hpp"
+#include "ThreadPool.hpp"
+#include "VectorKernel.hpp"
+
 #include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <random>
 #include <utility>
 
-Matrix::Matrix(std::size_t rowSize, std::size_t columnSize, float data)
-	: m_Elements(rowSize * columnSize, data), m_RowSize(rowSize), m_ColumnSize(columnSize) {
-	assert(rowSize > 0);
-	assert(columnSize > 0);
+namespace {
+	constexpr std::size_t ParallelRandomElementThreshold = 64 * 1024;
+
+	void DispatchAdd(std::size_t n, const float* x, float* y) noexcept {
+		GetComputeBackend().Add(n, x, y);
+	}
+	void DispatchAdd(std::size_t n, const double* x, double* y) noexcept {
+		AddKernel(n, x, y);
+	}
+	void DispatchSubtract(std::size_t n, const float* x, float* y) noexcept {
+		GetComputeBackend().Subtract(n, x, y);
+	}
+	void DispatchSubtract(std::size_t n, const double* x, double* y) noexcept {
+		SubtractKernel(n, x, y);
+	}
+	void DispatchMultiply(std::size_t n, const float* x, float* y) noexcept {
+		GetComputeBackend().Multiply(n, x, y);
+	}
+	void DispatchMultiply(std::size_t n, const double* x, double* y) noexcept {
+		MultiplyKernel(n, x, y);
+	}
+	void DispatchScale(std::size_t n, float alpha, float* y) noexcept {
+		GetComputeBackend().Scale(n, alpha, y);
+	}
+	void DispatchScale(std::size_t n, double alpha, double* y) noexcept {
+		ScaleKernel(n, alpha, y);
+	}
+	void DispatchAxpy(std::size_t n, float alpha, const float* x, float* y) noexcept {
+		GetComputeBackend().Axpy(n, alpha, x, y);
+	}
+	void DispatchAxpy(std::size_t n, double alpha, const double* x, double* y) noexcept {
+		AxpyKernel(n, alpha, x, y);
+	}
+	void DispatchAddScalar(std::size_t n, float alpha, float* y) noexcept {
+		GetComputeBackend().AddScalar(n, alpha, y);
+	}
+	void DispatchAddScalar(std::size_t n, double alpha, double* y) noexcept {
+		AddScalarKernel(n, alpha, y);
+	}
+	float DispatchSum(std::size_t n, const float* x) noexcept {
+		return GetComputeBackend().Sum(n, x);
+	}
+	double DispatchSum(std::size_t n, const double* x) noexcept {
+		return SumKernel(n, x);
+	}
+	void DispatchGemm(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+		float beta, float* c, std::size_t ldc) {
+		const ComputeBackend& backend = GetComputeBackend();
+
+		if (n == 1) {
+			backend.Gemv(transposeA, transposeA ? k : m, transposeA ? m : k, alpha, a, lda,
+				b, transposeB ? 1 : ldb, beta, c, ldc);
+		} else if (m == 1) {
+			backend.Gemv(!transposeB, transposeB ? n : k, transposeB ? k : n, alpha, b, ldb,
+				a, transposeA ? lda : 1, beta, c, 1);
+		} else if (k == 1) {
+			for (std::size_t i = 0; i < m; ++i) {
+				if (beta == 0.f) {
+					std::fill_n(c + i * ldc, n, 0.f);
+				} else if (beta != 1.f) {
+					backend.Scale(n, beta, c + i * ldc);
+				}
+			}
+
+			backend.Ger(m, n, alpha, a, transposeA ? 1 : lda, b, transposeB ? ldb : 1, c, ldc);
+		} else {
+			backend.Gemm(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+		}
+	}
+	void DispatchGemm(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		double alpha, const double* a, std::size_t lda, const double* b, std::size_t ldb,
+		double beta, double* c, std::size_t ldc) {
+		GemmKernel(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+	}
+}
+
+template<typename T>
+BasicConstMatrixView<T>::BasicConstMatrixView(const T* data, std::size_t rowSize, std::size_t columnSize,
+	std::size_t stride) noexcept
+	: m_Data(data), m_RowSize(rowSize), m_ColumnSize(columnSize), m_Stride(stride) {
+	assert(stride >= columnSize);
+}
+
+template<typename T>
+T BasicConstMatrixView<T>::operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+	assert(rowIndex < m_RowSize);
+	assert(columnIndex < m_ColumnSize);
+
+	return m_Data[rowIndex * m_Stride + columnIndex];
+}
+
+template<typename T>
+std::pair<std::size_t, std::size_t> BasicConstMatrixView<T>::GetSize() const noexcept {
+	return { m_RowSize, m_ColumnSize };
+}
+template<typename T>
+std::size_t BasicConstMatrixView<T>::GetRowSize() const noexcept {
+	return m_RowSize;
+}
+template<typename T>
+std::size_t BasicConstMatrixView<T>::GetColumnSize() const noexcept {
+	return m_ColumnSize;
+}
+template<typename T>
+std::size_t BasicConstMatrixView<T>::GetStride() const noexcept {
+	return m_Stride;
+}
+template<typename T>
+bool BasicConstMatrixView<T>::IsContiguous() const noexcept {
+	return m_Stride == m_ColumnSize || m_RowSize <= 1;
+}
+template<typename T>
+const T* BasicConstMatrixView<T>::GetData() const noexcept {
+	return m_Data;
+}
+
+template<typename T>
+BasicConstMatrixView<T> BasicConstMatrixView<T>::Row(std::size_t rowIndex) const noexcept {
+	return Block(rowIndex, 0, 1, m_ColumnSize);
+}
+template<typename T>
+BasicConstMatrixView<T> BasicConstMatrixView<T>::Column(std::size_t columnIndex) const noexcept {
+	return Block(0, columnIndex, m_RowSize, 1);
 }
-Matrix::Matrix(std::size_t rowSize, std::size_t columnSize, std::vector<float> elements) noexcept
-	: m_Elements(std::move(elements)), m_RowSize(rowSize), m_ColumnSize(columnSize) {
+template<typename T>
+BasicConstMatrixView<T> BasicConstMatrixView<T>::Block(std::size_t rowIndex, std::size_t columnIndex,
+	std::size_t rowSize, std::size_t columnSize) const noexcept {
+	assert(rowIndex + rowSize <= m_RowSize);
+	assert(columnIndex + columnSize <= m_ColumnSize);
+
+	return { m_Data + rowIndex * m_Stride + columnIndex, rowSize, columnSize, m_Stride };
+}
+
+template<typename T>
+BasicMatrixView<T>::BasicMatrixView(T* data, std::size_t rowSize, std::size_t columnSize, std::size_t stride) noexcept
+	: m_Data(data), m_RowSize(rowSize), m_ColumnSize(columnSize), m_Stride(stride) {
+	assert(stride >= columnSize);
+}
+
+template<typename T>
+T& BasicMatrixView<T>::operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+	assert(rowIndex < m_RowSize);
+	assert(columnIndex < m_ColumnSize);
+
+	return m_Data[rowIndex * m_Stride + columnIndex];
+}
+template<typename T>
+BasicMatrixView<T>::operator BasicConstMatrixView<T>() const noexcept {
+	return { m_Data, m_RowSize, m_ColumnSize, m_Stride };
+}
+
+template<typename T>
+std::pair<std::size_t, std::size_t> BasicMatrixView<T>::GetSize() const noexcept {
+	return { m_RowSize, m_ColumnSize };
+}
+template<typename T>
+std::size_t BasicMatrixView<T>::GetRowSize() const noexcept {
+	return m_RowSize;
+}
+template<typename T>
+std::size_t BasicMatrixView<T>::GetColumnSize() const noexcept {
+	return m_ColumnSize;
+}
+template<typename T>
+std::size_t BasicMatrixView<T>::GetStride() const noexcept {
+	return m_Stride;
+}
+template<typename T>
+bool BasicMatrixView<T>::IsContiguous() const noexcept {
+	return m_Stride == m_ColumnSize || m_RowSize <= 1;
+}
+template<typename T>
+T* BasicMatrixView<T>::GetData() const noexcept {
+	return m_Data;
+}
+
+template<typename T>
+BasicMatrixView<T> BasicMatrixView<T>::Row(std::size_t rowIndex) const noexcept {
+	return Block(rowIndex, 0, 1, m_ColumnSize);
+}
+template<typename T>
+BasicMatrixView<T> BasicMatrixView<T>::Column(std::size_t columnIndex) const noexcept {
+	return Block(0, columnIndex, m_RowSize, 1);
+}
+template<typename T>
+BasicMatrixView<T> BasicMatrixView<T>::Block(std::size_t rowIndex, std::size_t columnIndex,
+	std::size_t rowSize, std::size_t columnSize) const noexcept {
+	assert(rowIndex + rowSize <= m_RowSize);
+	assert(columnIndex + columnSize <= m_ColumnSize);
+
+	return { m_Data + rowIndex * m_Stride + columnIndex, rowSize, columnSize, m_Stride };
+}
+
+template<typename T>
+BasicMatrix<T>::BasicMatrix(std::size_t rowSize, std::size_t columnSize, T data)
+	: m_RowSize(rowSize), m_ColumnSize(columnSize), m_Stride(GetMatrixAllocator().GetRowStride(columnSize)),
+	m_Elements(rowSize * m_Stride, data) {
 	assert(rowSize > 0);
 	assert(columnSize > 0);
-	assert(rowSize * columnSize == m_Elements.size());
 }
+template<typename T>
+BasicMatrix<T>::BasicMatrix(std::size_t rowSize, std::size_t columnSize, std::vector<T> elements)
+	: BasicMatrix(rowSize, columnSize) {
+	assert(rowSize * columnSize == elements.size());
 
-bool Matrix::operator==(const Matrix& other) const noexcept {
-	return GetSize() == other.GetSize() &&
-		std::equal(m_Elements.begin(), m_Elements.end(), other.m_Elements.begin(), other.m_Elements.end());
-}
-Matrix Matrix::operator+(const Matrix& other) const {
-	return Matrix(*this) += other;
+	Copy(*this, BasicConstMatrixView<T>(elements.data(), rowSize, columnSize, columnSize));
 }
-Matrix Matrix::operator-(const Matrix& other) const {
-	return Matrix(*this) -= other;
+template<typename T>
+BasicMatrix<T>::BasicMatrix(BasicConstMatrixView<T> view)
+	: BasicMatrix(view.GetRowSize(), view.GetColumnSize()) {
+	Copy(*this, view);
 }
-Matrix Matrix::operator*(float scalar) const {
-	return Matrix(*this) *= scalar;
+
+template<typename T>
+bool BasicMatrix<T>::operator==(const BasicMatrix& other) const noexcept {
+	if (GetSize() != other.GetSize()) return false;
+
+	bool result = true;
+
+	VisitRows(*this, other, [&result](std::size_t n, const T* x, const T* y) noexcept {
+		result = result && std::equal(x, x + n, y);
+	});
+
+	return result;
 }
-Matrix Matrix::operator*(const Matrix& other) const {
+template<typename T>
+BasicMatrix<T> BasicMatrix<T>::operator*(const BasicMatrix& other) const {
 	assert(m_ColumnSize == other.m_RowSize);
 
-	Matrix result(m_RowSize, other.m_ColumnSize);
+	BasicMatrix result(m_RowSize, other.m_ColumnSize);
 
-	for (std::size_t i = 0; i < m_RowSize; ++i) {
-		for (std::size_t j = 0; j < other.m_ColumnSize; ++j) {
-			for (std::size_t k = 0; k < m_ColumnSize; ++k) {
-				result(i, j) += (*this)(i, k) * other(k, j);
-			}
-		}
-	}
+	Gemm(result, *this, other);
 
 	return result;
 }
-Matrix& Matrix::operator+=(const Matrix& other) noexcept {
+template<typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const BasicMatrix& other) noexcept {
 	assert(GetSize() == other.GetSize());
 
-	for (std::size_t i = 0; i < m_Elements.size(); ++i) {
-		m_Elements[i] += other.m_Elements[i];
-	}
+	Add(*this, other);
 
 	return *this;
 }
-Matrix& Matrix::operator-=(const Matrix& other) noexcept {
+template<typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const BasicMatrix& other) noexcept {
 	assert(GetSize() == other.GetSize());
 
-	for (std::size_t i = 0; i < m_Elements.size(); ++i) {
-		m_Elements[i] -= other.m_Elements[i];
-	}
+	Subtract(*this, other);
 
 	return *this;
 }
-Matrix& Matrix::operator*=(float scalar) noexcept {
-	for (std::size_t i = 0; i < m_Elements.size(); ++i) {
-		m_Elements[i] *= scalar;
-	}
+template<typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(T scalar) noexcept {
+	Scale(*this, scalar);
 
 	return *this;
 }
-Matrix& Matrix::operator*=(const Matrix& other) {
+template<typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator*=(const BasicMatrix& other) {
 	return *this = *this * other;
 }
-float Matrix::operator[](const std::pair<std::size_t, std::size_t>& index) const noexcept {
+template<typename T>
+T BasicMatrix<T>::operator[](const std::pair<std::size_t, std::size_t>& index) const noexcept {
 	return (*this)(index.first, index.second);
 }
-float& Matrix::operator[](const std::pair<std::size_t, std::size_t>& index) noexcept {
+template<typename T>
+T& BasicMatrix<T>::operator[](const std::pair<std::size_t, std::size_t>& index) noexcept {
 	return (*this)(index.first, index.second);
 }
-float Matrix::operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+template<typename T>
+T BasicMatrix<T>::operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
 	assert(rowIndex < m_RowSize);
 	assert(columnIndex < m_ColumnSize);
 
-	return m_Elements[rowIndex * m_ColumnSize + columnIndex];
+	return m_Elements[rowIndex * m_Stride + columnIndex];
 }
-float& Matrix::operator()(std::size_t rowIndex, std::size_t columnIndex) noexcept {
+template<typename T>
+T& BasicMatrix<T>::operator()(std::size_t rowIndex, std::size_t columnIndex) noexcept {
 	assert(rowIndex < m_RowSize);
 	assert(columnIndex < m_ColumnSize);
 
-	return m_Elements[rowIndex * m_ColumnSize + columnIndex];
+	return m_Elements[rowIndex * m_Stride + columnIndex];
+}
+template<typename T>
+BasicMatrix<T>::operator BasicConstMatrixView<T>() const noexcept {
+	return { GetData(), m_RowSize, m_ColumnSize, m_Stride };
+}
+template<typename T>
+BasicMatrix<T>::operator BasicMatrixView<T>() noexcept {
+	return { GetData(), m_RowSize, m_ColumnSize, m_Stride };
 }
 
-std::pair<std::size_t, std::size_t> Matrix::GetSize() const noexcept {
+template<typename T>
+std::pair<std::size_t, std::size_t> BasicMatrix<T>::GetSize() const noexcept {
 	return { m_RowSize, m_ColumnSize };
 }
-std::size_t Matrix::GetRowSize() const noexcept {
+template<typename T>
+std::size_t BasicMatrix<T>::GetRowSize() const noexcept {
 	return m_RowSize;
 }
-std::size_t Matrix::GetColumnSize() const noexcept {
+template<typename T>
+std::size_t BasicMatrix<T>::GetColumnSize() const noexcept {
 	return m_ColumnSize;
 }
-bool Matrix::IsZeroMatrix() const noexcept {
+template<typename T>
+void BasicMatrix<T>::Resize(std::size_t rowSize, std::size_t columnSize) {
+	if (m_RowSize == rowSize && m_ColumnSize == columnSize) return;
+
+	m_RowSize = rowSize;
+	m_ColumnSize = columnSize;
+	m_Stride = GetMatrixAllocator().GetRowStride(columnSize);
+	m_Elements.resize(rowSize * m_Stride);
+}
+template<typename T>
+std::size_t BasicMatrix<T>::GetStride() const noexcept {
+	return m_Stride;
+}
+template<typename T>
+bool BasicMatrix<T>::IsContiguous() const noexcept {
+	return m_Stride == m_ColumnSize || m_RowSize <= 1;
+}
+template<typename T>
+bool BasicMatrix<T>::IsZeroMatrix() const noexcept {
 	return m_RowSize == 0;
 }
+template<typename T>
+const T* BasicMatrix<T>::GetData() const noexcept {
+	return m_Elements.data();
+}
+template<typename T>
+T* BasicMatrix<T>::GetData() noexcept {
+	return m_Elements.data();
+}
+
+template<typename T>
+BasicConstMatrixView<T> BasicMatrix<T>::Row(std::size_t rowIndex) const noexcept {
+	return static_cast<BasicConstMatrixView<T>>(*this).Row(rowIndex);
+}
+template<typename T>
+BasicMatrixView<T> BasicMatrix<T>::Row(std::size_t rowIndex) noexcept {
+	return static_cast<BasicMatrixView<T>>(*this).Row(rowIndex);
+}
+template<typename T>
+BasicConstMatrixView<T> BasicMatrix<T>::Column(std::size_t columnIndex) const noexcept {
+	return static_cast<BasicConstMatrixView<T>>(*this).Column(columnIndex);
+}
+template<typename T>
+BasicMatrixView<T> BasicMatrix<T>::Column(std::size_t columnIndex) noexcept {
+	return static_cast<BasicMatrixView<T>>(*this).Column(columnIndex);
+}
+template<typename T>
+BasicConstMatrixView<T> BasicMatrix<T>::Block(std::size_t rowIndex, std::size_t columnIndex,
+	std::size_t rowSize, std::size_t columnSize) const noexcept {
+	return static_cast<BasicConstMatrixView<T>>(*this).Block(rowIndex, columnIndex, rowSize, columnSize);
+}
+template<typename T>
+BasicMatrixView<T> BasicMatrix<T>::Block(std::size_t rowIndex, std::size_t columnIndex,
+	std::size_t rowSize, std::size_t columnSize) noexcept {
+	return static_cast<BasicMatrixView<T>>(*this).Block(rowIndex, columnIndex, rowSize, columnSize);
+}
 
-Matrix& Matrix::HadamardProduct(const Matrix& other) noexcept {
+template<typename T>
+BasicMatrix<T>& BasicMatrix<T>::HadamardProduct(const BasicMatrix& other) noexcept {
 	assert(GetSize() == other.GetSize());
 
-	for (std::size_t i = 0; i < m_Elements.size(); ++i) {
-		m_Elements[i] *= other.m_Elements[i];
-	}
+	TransformRows(*this, other, [](std::size_t n, const T* x, T* y) noexcept {
+		DispatchMultiply(n, x, y);
+	});
 
 	return *this;
 }
-Matrix& Matrix::Transpose() {
-	return *this = ::Transpose(*this);
+template<typename T>
+BasicMatrix<T>& BasicMatrix<T>::Transpose() {
+	if (m_RowSize != m_ColumnSize) return *this = ::Transpose(*this);
+
+	TransposeInPlaceKernel(m_RowSize, m_Elements.data(), m_Stride);
+
+	return *this;
+}
+
+template class BasicConstMatrixView<float>;
+template class BasicConstMatrixView<double>;
+template class BasicMatrixView<float>;
+template class BasicMatrixView<double>;
+template class BasicMatrix<float>;
+template class BasicMatrix<double>;
+
+CompactMatrix::CompactMatrix(ConstMatrixView matrix, MatrixPrecision precision) {
+	Assign(matrix, precision);
+}
+
+float CompactMatrix::operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+	assert(rowIndex < m_RowSize);
+	assert(columnIndex < m_ColumnSize);
+
+	const std::uint16_t element = m_Elements[rowIndex * m_ColumnSize + columnIndex];
+
+	return m_Precision == MatrixPrecision::BFloat16 ? BFloat16ToFloat(element) : Float16ToFloat(element);
 }
 
-Matrix RandomMatrix(std::size_t rowSize, std::size_t columnSize, float elementMin, float elementMax) {
+std::pair<std::size_t, std::size_t> CompactMatrix::GetSize() const noexcept {
+	return { m_RowSize, m_ColumnSize };
+}
+std::size_t CompactMatrix::GetRowSize() const noexcept {
+	return m_RowSize;
+}
+std::size_t CompactMatrix::GetColumnSize() const noexcept {
+	return m_ColumnSize;
+}
+MatrixPrecision CompactMatrix::GetPrecision() const noexcept {
+	return m_Precision;
+}
+bool CompactMatrix::IsEmpty() const noexcept {
+	return m_Elements.empty();
+}
+const std::uint16_t* CompactMatrix::GetData() const noexcept {
+	return m_Elements.data();
+}
+
+void CompactMatrix::Assign(ConstMatrixView matrix, MatrixPrecision precision) {
+	assert(precision != MatrixPrecision::Float32);
+
+	const auto [row, column] = matrix.GetSize();
+
+	m_RowSize = row;
+	m_ColumnSize = column;
+	m_Precision = precision;
+	m_Elements.resize(row * column);
+
+	const auto convert = precision == MatrixPrecision::BFloat16 ? FloatToBFloat16Kernel : FloatToFloat16Kernel;
+
+	for (std::size_t i = 0; i < row; ++i) {
+		convert(column, matrix.GetData() + i * matrix.GetStride(), m_Elements.data() + i * column);
+	}
+}
+void CompactMatrix::Expand(MatrixView destination) const noexcept {
+	assert(destination.GetSize() == GetSize());
+
+	const auto convert = m_Precision == MatrixPrecision::BFloat16 ? BFloat16ToFloatKernel : Float16ToFloatKernel;
+
+	for (std::size_t i = 0; i < m_RowSize; ++i) {
+		convert(m_ColumnSize, m_Elements.data() + i * m_ColumnSize, destination.GetData() + i * destination.GetStride());
+	}
+}
+Matrix CompactMatrix::Expand() const {
+	if (IsEmpty()) return {};
+
+	Matrix result(m_RowSize, m_ColumnSize);
+
+	Expand(result);
+
+	return result;
+}
+
+namespace {
+	std::int8_t QuantizeToInt8(float value) noexcept {
+		return static_cast<std::int8_t>(std::clamp(std::nearbyint(value), -127.f, 127.f));
+	}
+}
+
+QuantizedMatrix::QuantizedMatrix(ConstMatrixView matrix) {
+	Assign(matrix);
+}
+
+float QuantizedMatrix::operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+	assert(rowIndex < m_RowSize);
+	assert(columnIndex < m_ColumnSize);
+
+	return m_Scales[rowIndex] * m_Elements[rowIndex * m_ColumnSize + columnIndex];
+}
+
+std::pair<std::size_t, std::size_t> QuantizedMatrix::GetSize() const noexcept {
+	return { m_RowSize, m_ColumnSize };
+}
+std::size_t QuantizedMatrix::GetRowSize() const noexcept {
+	return m_RowSize;
+}
+std::size_t QuantizedMatrix::GetColumnSize() const noexcept {
+	return m_ColumnSize;
+}
+bool QuantizedMatrix::IsEmpty() const noexcept {
+	return m_Elements.empty();
+}
+const std::int8_t* QuantizedMatrix::GetData() const noexcept {
+	return m_Elements.data();
+}
+const float* QuantizedMatrix::GetScales() const noexcept {
+	return m_Scales.data();
+}
+
+void QuantizedMatrix::Assign(ConstMatrixView matrix) {
+	const auto [row, column] = matrix.GetSize();
+
+	m_RowSize = row;
+	m_ColumnSize = column;
+	m_Scales.resize(row);
+	m_Elements.resize(row * column);
+
+	for (std::size_t i = 0; i < row; ++i) {
+		const float* const source = matrix.GetData() + i * matrix.GetStride();
+		float maxMagnitude = 0.f;
+
+		for (std::size_t j = 0; j < column; ++j) {
+			maxMagnitude = std::max(maxMagnitude, std::abs(source[j]));
+		}
+
+		const float scale = maxMagnitude > 0.f ? maxMagnitude / 127.f : 1.f;
+		const float inverseScale = 1.f / scale;
+
+		for (std::size_t j = 0; j < column; ++j) {
+			m_Elements[i * column + j] = QuantizeToInt8(source[j] * inverseScale);
+		}
+
+		m_Scales[i] = scale;
+	}
+}
+void QuantizedMatrix::AssignTransposed(ConstMatrixView matrix, const std::vector<float>& rowScales) {
+	assert(rowScales.size() == matrix.GetRowSize());
+
+	const auto [row, column] = matrix.GetSize();
+
+	m_RowSize = column;
+	m_ColumnSize = row;
+	m_Scales.assign(column, 1.f);
+	m_Elements.resize(row * column);
+
+	for (std::size_t i = 0; i < row; ++i) {
+		assert(rowScales[i] > 0.f);
+
+		const float* const source = matrix.GetData() + i * matrix.GetStride();
+		const float inverseScale = 1.f / rowScales[i];
+
+		for (std::size_t j = 0; j < column; ++j) {
+			m_Elements[j * row + i] = QuantizeToInt8(source[j] * inverseScale);
+		}
+	}
+}
+Matrix QuantizedMatrix::Expand() const {
+	if (IsEmpty()) return {};
+
+	Matrix result(m_RowSize, m_ColumnSize);
+
+	for (std::size_t i = 0; i < m_RowSize; ++i) {
+		for (std::size_t j = 0; j < m_ColumnSize; ++j) {
+			result(i, j) = (*this)(i, j);
+		}
+	}
+
+	return result;
+}
+
+SparseMatrix::SparseMatrix(std::size_t rowSize, std::size_t columnSize, SparseMatrixFormat format)
+	: m_RowSize(rowSize), m_ColumnSize(columnSize), m_Format(format),
+	m_Offsets((format == SparseMatrixFormat::CSR ? rowSize : columnSize) + 1, 0) {}
+SparseMatrix::SparseMatrix(std::size_t rowSize, std::size_t columnSize, SparseMatrixFormat format,
+	std::vector<std::size_t> offsets, std::vector<std::size_t> indices, std::vector<float> values)
+	: m_RowSize(rowSize), m_ColumnSize(columnSize), m_Format(format),
+	m_Offsets(std::move(offsets)), m_Indices(std::move(indices)), m_Values(std::move(values)) {
+	assert(m_Offsets.size() == (format == SparseMatrixFormat::CSR ? rowSize : columnSize) + 1);
+	assert(m_Offsets.front() == 0);
+	assert(m_Offsets.back() == m_Indices.size());
+	assert(m_Indices.size() == m_Values.size());
+	assert(std::ranges::is_sorted(m_Offsets));
+}
+SparseMatrix::SparseMatrix(ConstMatrixView matrix, SparseMatrixFormat format) {
+	Assign(matrix, format);
+}
+
+float SparseMatrix::operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+	assert(rowIndex < m_RowSize);
+	assert(columnIndex < m_ColumnSize);
+
+	const bool isCSR = m_Format == SparseMatrixFormat::CSR;
+	const std::size_t majorIndex = isCSR ? rowIndex : columnIndex;
+	const std::size_t minorIndex = isCSR ? columnIndex : rowIndex;
+	const auto begin = m_Indices.begin() + m_Offsets[majorIndex];
+	const auto end = m_Indices.begin() + m_Offsets[majorIndex + 1];
+	const auto iter = std::lower_bound(begin, end, minorIndex);
+
+	return iter != end && *iter == minorIndex ? m_Values[iter - m_Indices.begin()] : 0.f;
+}
+
+std::pair<std::size_t, std::size_t> SparseMatrix::GetSize() const noexcept {
+	return { m_RowSize, m_ColumnSize };
+}
+std::size_t SparseMatrix::GetRowSize() const noexcept {
+	return m_RowSize;
+}
+std::size_t SparseMatrix::GetColumnSize() const noexcept {
+	return m_ColumnSize;
+}
+SparseMatrixFormat SparseMatrix::GetFormat() const noexcept {
+	return m_Format;
+}
+std::size_t SparseMatrix::GetNonZeroCount() const noexcept {
+	return m_Values.size();
+}
+const std::size_t* SparseMatrix::GetOffsets() const noexcept {
+	return m_Offsets.data();
+}
+const std::size_t* SparseMatrix::GetIndices() const noexcept {
+	return m_Indices.data();
+}
+const float* SparseMatrix::GetValues() const noexcept {
+	return m_Values.data();
+}
+
+void SparseMatrix::Assign(ConstMatrixView matrix, SparseMatrixFormat format) {
+	const auto [row, column] = matrix.GetSize();
+	const bool isCSR = format == SparseMatrixFormat::CSR;
+	const std::size_t majorSize = isCSR ? row : column;
+	const std::size_t minorSize = isCSR ? column : row;
+
+	m_RowSize = row;
+	m_ColumnSize = column;
+	m_Format = format;
+	m_Offsets.resize(majorSize + 1);
+	m_Indices.clear();
+	m_Values.clear();
+
+	for (std::size_t i = 0; i < majorSize; ++i) {
+		m_Offsets[i] = m_Indices.size();
+
+		for (std::size_t j = 0; j < minorSize; ++j) {
+			const float value = isCSR ? matrix(i, j) : matrix(j, i);
+
+			if (value != 0.f) {
+				m_Indices.push_back(j);
+				m_Values.push_back(value);
+			}
+		}
+	}
+
+	m_Offsets[majorSize] = m_Indices.size();
+}
+void SparseMatrix::ConvertFormat(SparseMatrixFormat newFormat) {
+	if (newFormat == m_Format) return;
+
+	const std::size_t majorSize = m_Offsets.size() - 1;
+	const std::size_t minorSize = newFormat == SparseMatrixFormat::CSR ? m_RowSize : m_ColumnSize;
+	std::vector<std::size_t> offsets(minorSize + 1, 0);
+	std::vector<std::size_t> indices(m_Indices.size());
+	std::vector<float> values(m_Values.size());
+
+	for (const std::size_t index : m_Indices) {
+		++offsets[index + 1];
+	}
+
+	for (std::size_t i = 0; i < minorSize; ++i) {
+		offsets[i + 1] += offsets[i];
+	}
+
+	std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+
+	for (std::size_t i = 0; i < majorSize; ++i) {
+		for (std::size_t j = m_Offsets[i]; j < m_Offsets[i + 1]; ++j) {
+			const std::size_t position = positions[m_Indices[j]]++;
+
+			indices[position] = i;
+			values[position] = m_Values[j];
+		}
+	}
+
+	m_Format = newFormat;
+	m_Offsets = std::move(offsets);
+	m_Indices = std::move(indices);
+	m_Values = std::move(values);
+}
+void SparseMatrix::Expand(MatrixView result) const noexcept {
+	assert(result.GetSize() == GetSize());
+
+	const bool isCSR = m_Format == SparseMatrixFormat::CSR;
+
+	TransformRows(result, [](std::size_t n, float* y) noexcept {
+		std::fill_n(y, n, 0.f);
+	});
+
+	for (std::size_t i = 0; i + 1 < m_Offsets.size(); ++i) {
+		for (std::size_t j = m_Offsets[i]; j < m_Offsets[i + 1]; ++j) {
+			if (isCSR) {
+				result(i, m_Indices[j]) = m_Values[j];
+			} else {
+				result(m_Indices[j], i) = m_Values[j];
+			}
+		}
+	}
+}
+Matrix SparseMatrix::Expand() const {
+	Matrix result(m_RowSize, m_ColumnSize);
+
+	Expand(result);
+
+	return result;
+}
+
+template<typename T>
+BasicMatrix<T> RandomMatrix(std::size_t rowSize, std::size_t columnSize,
+	std::type_identity_t<T> elementMin, std::type_identity_t<T> elementMax) {
 	assert(std::isfinite(elementMin));
 	assert(std::isfinite(elementMax));
 	assert(elementMin < elementMax);
 
-	static std::mt19937 mt(std::random_device{}());
-	std::uniform_real_distribution<float> dist(elementMin, elementMax);
+	const std::uint64_t seed = GetRandomSeed();
+	const std::uint64_t stream = AcquireRandomStream();
 
-	Matrix result(rowSize, columnSize);
+	BasicMatrix<T> result(rowSize, columnSize);
+	T* const data = result.GetData();
+	const std::size_t stride = result.GetStride();
 
-	for (std::size_t i = 0; i < rowSize; ++i) {
-		for (std::size_t j = 0; j < columnSize; ++j) {
-			result(i, j) = dist(mt);
+	const auto generateRows = [&](std::size_t first, std::size_t count) noexcept {
+		for (std::size_t i = first; i < first + count; ++i) {
+			GenerateUniform<T>(seed, stream, i * columnSize, columnSize, elementMin, elementMax, data + i * stride);
 		}
+	};
+
+	ThreadPool& threadPool = GetDefaultThreadPool();
+	const std::size_t blockCount = rowSize * columnSize < ParallelRandomElementThreshold ? 1 :
+		std::min(rowSize, threadPool.GetThreadCount());
+
+	if (blockCount > 1) {
+		const std::size_t blockSize = (rowSize + blockCount - 1) / blockCount;
+
+		threadPool.Run(blockCount, [&](std::size_t blockIndex) {
+			const std::size_t first = blockIndex * blockSize;
+
+			if (first < rowSize) {
+				generateRows(first, std::min(blockSize, rowSize - first));
+			}
+		});
+	} else {
+		generateRows(0, rowSize);
 	}
 
 	return result;
 }
 
-Matrix operator*(float scalar, const Matrix& matrix) {
-	return matrix * scalar;
-}
-std::ostream& operator<<(std::ostream& stream, const Matrix& matrix) {
+template<typename T>
+std::ostream& operator<<(std::ostream& stream, const BasicMatrix<T>& matrix) {
 	if (matrix.IsZeroMatrix()) {
 		return stream << "[]";
 	}
@@ -164,18 +772,340 @@ std::ostream& operator<<(std::ostream& stream, const Matrix& matrix) {
 	return stream;
 }
 
-Matrix HadamardProduct(const Matrix& lhsMatrix, const Matrix& rhsMatrix) {
-	return Matrix(lhsMatrix).HadamardProduct(rhsMatrix);
-}
-Matrix Transpose(const Matrix& matrix) {
+template<typename T>
+BasicMatrix<T> Transpose(const BasicMatrix<T>& matrix) {
 	const auto [row, column] = matrix.GetSize();
-	Matrix result(column, row);
+	BasicMatrix<T> result(column, row);
 
-	for (std::size_t i = 0; i < row; ++i) {
-		for (std::size_t j = 0; j < column; ++j) {
-			result(j, i) = matrix(i, j);
+	::Transpose(result, matrix);
+
+	return result;
+}
+
+template Matrix RandomMatrix<float>(std::size_t, std::size_t, float, float);
+template BasicMatrix<double> RandomMatrix<double>(std::size_t, std::size_t, double, double);
+template std::ostream& operator<<(std::ostream&, const Matrix&);
+template std::ostream& operator<<(std::ostream&, const BasicMatrix<double>&);
+template Matrix Transpose(const Matrix&);
+template BasicMatrix<double> Transpose(const BasicMatrix<double>&);
+
+namespace {
+	template<typename T>
+	BasicMatrix<T> MultiplyTransposedLhsImpl(BasicConstMatrixView<T> lhsMatrix, BasicConstMatrixView<T> rhsMatrix) {
+		assert(lhsMatrix.GetRowSize() == rhsMatrix.GetRowSize());
+
+		BasicMatrix<T> result(lhsMatrix.GetColumnSize(), rhsMatrix.GetColumnSize());
+
+		GemmTransposedLhs(result, lhsMatrix, rhsMatrix);
+
+		return result;
+	}
+	template<typename T>
+	BasicMatrix<T> MultiplyTransposedRhsImpl(BasicConstMatrixView<T> lhsMatrix, BasicConstMatrixView<T> rhsMatrix) {
+		assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetColumnSize());
+
+		BasicMatrix<T> result(lhsMatrix.GetRowSize(), rhsMatrix.GetRowSize());
+
+		GemmTransposedRhs(result, lhsMatrix, rhsMatrix);
+
+		return result;
+	}
+	template<typename T>
+	BasicMatrix<T> ReferenceMultiplyImpl(BasicConstMatrixView<T> lhsMatrix, BasicConstMatrixView<T> rhsMatrix) {
+		assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetRowSize());
+
+		const auto [row, inner] = lhsMatrix.GetSize();
+		const std::size_t column = rhsMatrix.GetColumnSize();
+		BasicMatrix<T> result(row, column);
+
+		ReferenceGemmKernel(false, false, row, column, inner, T(1), lhsMatrix.GetData(), lhsMatrix.GetStride(),
+			rhsMatrix.GetData(), rhsMatrix.GetStride(), T(0), result.GetData(), result.GetStride());
+
+		return result;
+	}
+
+	template<typename T>
+	void CopyImpl(BasicMatrixView<T> destination, BasicConstMatrixView<T> source) noexcept {
+		TransformRows(destination, source, [](std::size_t n, const T* x, T* y) noexcept {
+			std::copy_n(x, n, y);
+		});
+	}
+	template<typename T>
+	void TransposeImpl(BasicMatrixView<T> destination, BasicConstMatrixView<T> source) noexcept {
+		assert(destination.GetRowSize() == source.GetColumnSize());
+		assert(destination.GetColumnSize() == source.GetRowSize());
+
+		TransposeKernel(source.GetRowSize(), source.GetColumnSize(), source.GetData(), source.GetStride(),
+			destination.GetData(), destination.GetStride());
+	}
+	template<typename T>
+	void AddImpl(BasicMatrixView<T> destination, BasicConstMatrixView<T> source) noexcept {
+		TransformRows(destination, source, [](std::size_t n, const T* x, T* y) noexcept {
+			DispatchAdd(n, x, y);
+		});
+	}
+	template<typename T>
+	void SubtractImpl(BasicMatrixView<T> destination, BasicConstMatrixView<T> source) noexcept {
+		TransformRows(destination, source, [](std::size_t n, const T* x, T* y) noexcept {
+			DispatchSubtract(n, x, y);
+		});
+	}
+	template<typename T>
+	void ScaleImpl(BasicMatrixView<T> destination, T scalar) noexcept {
+		TransformRows(destination, [scalar](std::size_t n, T* y) noexcept {
+			DispatchScale(n, scalar, y);
+		});
+	}
+	template<typename T>
+	void AxpyImpl(BasicMatrixView<T> destination, T alpha, BasicConstMatrixView<T> source) noexcept {
+		TransformRows(destination, source, [alpha](std::size_t n, const T* x, T* y) noexcept {
+			DispatchAxpy(n, alpha, x, y);
+		});
+	}
+	template<typename T>
+	void AddColumnVectorImpl(BasicMatrixView<T> destination, BasicConstMatrixView<T> columnVector) noexcept {
+		assert(columnVector.GetSize() == std::make_pair(destination.GetRowSize(), std::size_t(1)));
+
+		const auto [row, column] = destination.GetSize();
+
+		for (std::size_t i = 0; i < row; ++i) {
+			DispatchAddScalar(column, columnVector(i, 0), destination.GetData() + i * destination.GetStride());
 		}
 	}
+	template<typename T>
+	void AddRowVectorImpl(BasicMatrixView<T> destination, BasicConstMatrixView<T> rowVector) noexcept {
+		assert(rowVector.GetSize() == std::make_pair(std::size_t(1), destination.GetColumnSize()));
 
-	return result;
+		const auto [row, column] = destination.GetSize();
+
+		for (std::size_t i = 0; i < row; ++i) {
+			DispatchAdd(column, rowVector.GetData(), destination.GetData() + i * destination.GetStride());
+		}
+	}
+	template<typename T>
+	void SumRowsImpl(BasicMatrixView<T> result, BasicConstMatrixView<T> matrix) noexcept {
+		assert(result.GetSize() == std::make_pair(matrix.GetRowSize(), std::size_t(1)));
+
+		const auto [row, column] = matrix.GetSize();
+
+		for (std::size_t i = 0; i < row; ++i) {
+			result(i, 0) = DispatchSum(column, matrix.GetData() + i * matrix.GetStride());
+		}
+	}
+	template<typename T>
+	void SumColumnsImpl(BasicMatrixView<T> result, BasicConstMatrixView<T> matrix) noexcept {
+		assert(result.GetSize() == std::make_pair(std::size_t(1), matrix.GetColumnSize()));
+
+		const auto [row, column] = matrix.GetSize();
+
+		std::fill_n(result.GetData(), column, T(0));
+
+		for (std::size_t i = 0; i < row; ++i) {
+			DispatchAdd(column, matrix.GetData() + i * matrix.GetStride(), result.GetData());
+		}
+	}
+	template<typename T>
+	void GemmImpl(BasicMatrixView<T> result, BasicConstMatrixView<T> lhsMatrix, BasicConstMatrixView<T> rhsMatrix,
+		T alpha, T beta) {
+		assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetRowSize());
+		assert(result.GetRowSize() == lhsMatrix.GetRowSize());
+		assert(result.GetColumnSize() == rhsMatrix.GetColumnSize());
+
+		DispatchGemm(false, false, result.GetRowSize(), result.GetColumnSize(), lhsMatrix.GetColumnSize(),
+			alpha, lhsMatrix.GetData(), lhsMatrix.GetStride(), rhsMatrix.GetData(), rhsMatrix.GetStride(),
+			beta, result.GetData(), result.GetStride());
+	}
+	template<typename T>
+	void GemmTransposedLhsImpl(BasicMatrixView<T> result, BasicConstMatrixView<T> lhsMatrix,
+		BasicConstMatrixView<T> rhsMatrix, T alpha, T beta) {
+		assert(lhsMatrix.GetRowSize() == rhsMatrix.GetRowSize());
+		assert(result.GetRowSize() == lhsMatrix.GetColumnSize());
+		assert(result.GetColumnSize() == rhsMatrix.GetColumnSize());
+
+		DispatchGemm(true, false, result.GetRowSize(), result.GetColumnSize(), lhsMatrix.GetRowSize(),
+			alpha, lhsMatrix.GetData(), lhsMatrix.GetStride(), rhsMatrix.GetData(), rhsMatrix.GetStride(),
+			beta, result.GetData(), result.GetStride());
+	}
+	template<typename T>
+	void GemmTransposedRhsImpl(BasicMatrixView<T> result, BasicConstMatrixView<T> lhsMatrix,
+		BasicConstMatrixView<T> rhsMatrix, T alpha, T beta) {
+		assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetColumnSize());
+		assert(result.GetRowSize() == lhsMatrix.GetRowSize());
+		assert(result.GetColumnSize() == rhsMatrix.GetRowSize());
+
+		DispatchGemm(false, true, result.GetRowSize(), result.GetColumnSize(), lhsMatrix.GetColumnSize(),
+			alpha, lhsMatrix.GetData(), lhsMatrix.GetStride(), rhsMatrix.GetData(), rhsMatrix.GetStride(),
+			beta, result.GetData(), result.GetStride());
+	}
+}
+
+Matrix MultiplyTransposedLhs(ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix) {
+	return MultiplyTransposedLhsImpl(lhsMatrix, rhsMatrix);
+}
+Matrix MultiplyTransposedRhs(ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix) {
+	return MultiplyTransposedRhsImpl(lhsMatrix, rhsMatrix);
+}
+Matrix ReferenceMultiply(ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix) {
+	return ReferenceMultiplyImpl(lhsMatrix, rhsMatrix);
+}
+
+void Copy(MatrixView destination, ConstMatrixView source) noexcept {
+	CopyImpl(destination, source);
+}
+void Transpose(MatrixView destination, ConstMatrixView source) noexcept {
+	TransposeImpl(destination, source);
+}
+void Add(MatrixView destination, ConstMatrixView source) noexcept {
+	AddImpl(destination, source);
+}
+void Subtract(MatrixView destination, ConstMatrixView source) noexcept {
+	SubtractImpl(destination, source);
+}
+void Scale(MatrixView destination, float scalar) noexcept {
+	ScaleImpl(destination, scalar);
+}
+void Axpy(MatrixView destination, float alpha, ConstMatrixView source) noexcept {
+	AxpyImpl(destination, alpha, source);
+}
+void AddColumnVector(MatrixView destination, ConstMatrixView columnVector) noexcept {
+	AddColumnVectorImpl(destination, columnVector);
+}
+void AddRowVector(MatrixView destination, ConstMatrixView rowVector) noexcept {
+	AddRowVectorImpl(destination, rowVector);
+}
+void SumRows(MatrixView result, ConstMatrixView matrix) noexcept {
+	SumRowsImpl(result, matrix);
+}
+void SumColumns(MatrixView result, ConstMatrixView matrix) noexcept {
+	SumColumnsImpl(result, matrix);
+}
+void Gemm(MatrixView result, ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix, float alpha, float beta) {
+	GemmImpl(result, lhsMatrix, rhsMatrix, alpha, beta);
+}
+void GemmTransposedLhs(MatrixView result, ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha, float beta) {
+	GemmTransposedLhsImpl(result, lhsMatrix, rhsMatrix, alpha, beta);
+}
+void GemmTransposedRhs(MatrixView result, ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha, float beta) {
+	GemmTransposedRhsImpl(result, lhsMatrix, rhsMatrix, alpha, beta);
+}
+void Gemm(MatrixView result, const CompactMatrix& lhsMatrix, ConstMatrixView rhsMatrix, float alpha, float beta) {
+	assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetRowSize());
+	assert(result.GetRowSize() == lhsMatrix.GetRowSize());
+	assert(result.GetColumnSize() == rhsMatrix.GetColumnSize());
+
+	CompactGemmKernel(lhsMatrix.GetPrecision(), false, false, result.GetRowSize(), result.GetColumnSize(),
+		lhsMatrix.GetColumnSize(), alpha, lhsMatrix.GetData(), lhsMatrix.GetColumnSize(),
+		rhsMatrix.GetData(), rhsMatrix.GetStride(), beta, result.GetData(), result.GetStride());
+}
+void GemmTransposedLhs(MatrixView result, const CompactMatrix& lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha, float beta) {
+	assert(lhsMatrix.GetRowSize() == rhsMatrix.GetRowSize());
+	assert(result.GetRowSize() == lhsMatrix.GetColumnSize());
+	assert(result.GetColumnSize() == rhsMatrix.GetColumnSize());
+
+	CompactGemmKernel(lhsMatrix.GetPrecision(), true, false, result.GetRowSize(), result.GetColumnSize(),
+		lhsMatrix.GetRowSize(), alpha, lhsMatrix.GetData(), lhsMatrix.GetColumnSize(),
+		rhsMatrix.GetData(), rhsMatrix.GetStride(), beta, result.GetData(), result.GetStride());
+}
+void Gemm(MatrixView result, ConstMatrixView lhsMatrix, const SparseMatrix& rhsMatrix, float alpha, float beta) {
+	assert(rhsMatrix.GetFormat() == SparseMatrixFormat::CSC);
+	assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetRowSize());
+	assert(result.GetRowSize() == lhsMatrix.GetRowSize());
+	assert(result.GetColumnSize() == rhsMatrix.GetColumnSize());
+
+	SparseRhsGemmKernel(result.GetRowSize(), result.GetColumnSize(), alpha, lhsMatrix.GetData(), lhsMatrix.GetStride(),
+		rhsMatrix.GetOffsets(), rhsMatrix.GetIndices(), rhsMatrix.GetValues(), beta, result.GetData(), result.GetStride());
+}
+void Gemm(MatrixView result, const SparseMatrix& lhsMatrix, ConstMatrixView rhsMatrix, float alpha, float beta) {
+	assert(lhsMatrix.GetFormat() == SparseMatrixFormat::CSR);
+	assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetRowSize());
+	assert(result.GetRowSize() == lhsMatrix.GetRowSize());
+	assert(result.GetColumnSize() == rhsMatrix.GetColumnSize());
+
+	SparseLhsGemmKernel(result.GetRowSize(), result.GetColumnSize(), alpha,
+		lhsMatrix.GetOffsets(), lhsMatrix.GetIndices(), lhsMatrix.GetValues(), rhsMatrix.GetData(), rhsMatrix.GetStride(),
+		beta, result.GetData(), result.GetStride());
+}
+void GemmTransposedRhs(MatrixView result, ConstMatrixView lhsMatrix, const SparseMatrix& rhsMatrix, float alpha, float beta) {
+	assert(rhsMatrix.GetFormat() == SparseMatrixFormat::CSC);
+	assert(lhsMatrix.GetColumnSize() == rhsMatrix.GetColumnSize());
+	assert(result.GetRowSize() == lhsMatrix.GetRowSize());
+	assert(result.GetColumnSize() == rhsMatrix.GetRowSize());
+
+	SparseRhsTransposedGemmKernel(result.GetRowSize(), result.GetColumnSize(), lhsMatrix.GetColumnSize(), alpha,
+		lhsMatrix.GetData(), lhsMatrix.GetStride(), rhsMatrix.GetOffsets(), rhsMatrix.GetIndices(), rhsMatrix.GetValues(),
+		beta, result.GetData(), result.GetStride());
+}
+void QuantizedGemm(MatrixView result, const QuantizedMatrix& lhsMatrix, const QuantizedMatrix& transposedRhsMatrix,
+	ConstMatrixView bias, const std::function<void(MatrixView)>& epilogue) {
+	assert(lhsMatrix.GetColumnSize() == transposedRhsMatrix.GetColumnSize());
+	assert(result.GetRowSize() == lhsMatrix.GetRowSize());
+	assert(result.GetColumnSize() == transposedRhsMatrix.GetRowSize());
+	assert(bias.GetSize() == std::make_pair(result.GetRowSize(), std::size_t(1)));
+
+	const auto [row, column] = result.GetSize();
+	const std::size_t inner = lhsMatrix.GetColumnSize();
+
+	QuantizedGemmKernel(row, column, inner, lhsMatrix.GetData(), inner, lhsMatrix.GetScales(),
+		transposedRhsMatrix.GetData(), inner, transposedRhsMatrix.GetScales(), bias.GetData(), bias.GetStride(),
+		result.GetData(), result.GetStride(), [&](std::size_t rowIndex, std::size_t rowSize) {
+			if (epilogue) {
+				epilogue(result.Block(rowIndex, 0, rowSize, column));
+			}
+		});
+}
+
+BasicMatrix<double> MultiplyTransposedLhs(BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix) {
+	return MultiplyTransposedLhsImpl(lhsMatrix, rhsMatrix);
+}
+BasicMatrix<double> MultiplyTransposedRhs(BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix) {
+	return MultiplyTransposedRhsImpl(lhsMatrix, rhsMatrix);
+}
+BasicMatrix<double> ReferenceMultiply(BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix) {
+	return ReferenceMultiplyImpl(lhsMatrix, rhsMatrix);
+}
+
+void Copy(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept {
+	CopyImpl(destination, source);
+}
+void Transpose(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept {
+	TransposeImpl(destination, source);
+}
+void Add(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept {
+	AddImpl(destination, source);
+}
+void Subtract(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept {
+	SubtractImpl(destination, source);
+}
+void Scale(BasicMatrixView<double> destination, double scalar) noexcept {
+	ScaleImpl(destination, scalar);
+}
+void Axpy(BasicMatrixView<double> destination, double alpha, BasicConstMatrixView<double> source) noexcept {
+	AxpyImpl(destination, alpha, source);
+}
+void AddColumnVector(BasicMatrixView<double> destination, BasicConstMatrixView<double> columnVector) noexcept {
+	AddColumnVectorImpl(destination, columnVector);
+}
+void AddRowVector(BasicMatrixView<double> destination, BasicConstMatrixView<double> rowVector) noexcept {
+	AddRowVectorImpl(destination, rowVector);
+}
+void SumRows(BasicMatrixView<double> result, BasicConstMatrixView<double> matrix) noexcept {
+	SumRowsImpl(result, matrix);
+}
+void SumColumns(BasicMatrixView<double> result, BasicConstMatrixView<double> matrix) noexcept {
+	SumColumnsImpl(result, matrix);
+}
+void Gemm(BasicMatrixView<double> result, BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix,
+	double alpha, double beta) {
+	GemmImpl(result, lhsMatrix, rhsMatrix, alpha, beta);
+}
+void GemmTransposedLhs(BasicMatrixView<double> result, BasicConstMatrixView<double> lhsMatrix,
+	BasicConstMatrixView<double> rhsMatrix, double alpha, double beta) {
+	GemmTransposedLhsImpl(result, lhsMatrix, rhsMatrix, alpha, beta);
+}
+void GemmTransposedRhs(BasicMatrixView<double> result, BasicConstMatrixView<double> lhsMatrix,
+	BasicConstMatrixView<double> rhsMatrix, double alpha, double beta) {
+	GemmTransposedRhsImpl(result, lhsMatrix, rhsMatrix, alpha, beta);
 }
\ No newline at end of file
@@ -1,54 +1,535 @@
 #pragma once
 
+#include "HalfFloat.hpp"
+#include "MatrixAllocator.hpp"
+
+#include <cassert>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <ostream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-class Matrix final {
+template<typename T>
+class BasicMatrix;
+
+template<typename T>
+class BasicConstMatrixView final {
 private:
-	std::vector<float> m_Elements;
+	const T* m_Data = nullptr;
 	std::size_t m_RowSize = 0, m_ColumnSize = 0;
+	std::size_t m_Stride = 0;
 
 public:
-	Matrix() noexcept = default;
-	Matrix(std::size_t rowSize, std::size_t columnSize, float data = 0.f);
-	Matrix(std::size_t rowSize, std::size_t columnSize, std::vector<float> elements) noexcept;
-	Matrix(const Matrix& other) = default;
-	Matrix(Matrix&& other) noexcept = default;
-	~Matrix() = default;
-
-public:
-	Matrix& operator=(const Matrix& other) = default;
-	Matrix& operator=(Matrix&& other) noexcept = default;
-	bool operator==(const Matrix& other) const noexcept;
-	Matrix operator+(const Matrix& other) const;
-	Matrix operator-(const Matrix& other) const;
-	Matrix operator*(float scalar) const;
-	Matrix operator*(const Matrix& other) const;
-	Matrix& operator+=(const Matrix& other) noexcept;
-	Matrix& operator-=(const Matrix& other) noexcept;
-	Matrix& operator*=(float scalar) noexcept;
-	Matrix& operator*=(const Matrix& other);
-	float operator[](const std::pair<std::size_t, std::size_t>& index) const noexcept;
-	float& operator[](const std::pair<std::size_t, std::size_t>& index) noexcept;
-	float operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept;
-	float& operator()(std::size_t rowIndex, std::size_t columnIndex) noexcept;
+	BasicConstMatrixView() noexcept = default;
+	BasicConstMatrixView(const T* data, std::size_t rowSize, std::size_t columnSize, std::size_t stride) noexcept;
+	BasicConstMatrixView(const BasicConstMatrixView& other) noexcept = default;
+	~BasicConstMatrixView() = default;
+
+public:
+	BasicConstMatrixView& operator=(const BasicConstMatrixView& other) noexcept = default;
+	T operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept;
+
+public:
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
+	std::size_t GetRowSize() const noexcept;
+	std::size_t GetColumnSize() const noexcept;
+	std::size_t GetStride() const noexcept;
+	bool IsContiguous() const noexcept;
+	const T* GetData() const noexcept;
+
+	BasicConstMatrixView Row(std::size_t rowIndex) const noexcept;
+	BasicConstMatrixView Column(std::size_t columnIndex) const noexcept;
+	BasicConstMatrixView Block(std::size_t rowIndex, std::size_t columnIndex,
+		std::size_t rowSize, std::size_t columnSize) const noexcept;
+};
+
+template<typename T>
+class BasicMatrixView final {
+private:
+	T* m_Data = nullptr;
+	std::size_t m_RowSize = 0, m_ColumnSize = 0;
+	std::size_t m_Stride = 0;
+
+public:
+	BasicMatrixView() noexcept = default;
+	BasicMatrixView(T* data, std::size_t rowSize, std::size_t columnSize, std::size_t stride) noexcept;
+	BasicMatrixView(const BasicMatrixView& other) noexcept = default;
+	~BasicMatrixView() = default;
+
+public:
+	BasicMatrixView& operator=(const BasicMatrixView& other) noexcept = default;
+	T& operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept;
+	operator BasicConstMatrixView<T>() const noexcept;
+
+public:
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
+	std::size_t GetRowSize() const noexcept;
+	std::size_t GetColumnSize() const noexcept;
+	std::size_t GetStride() const noexcept;
+	bool IsContiguous() const noexcept;
+	T* GetData() const noexcept;
+
+	BasicMatrixView Row(std::size_t rowIndex) const noexcept;
+	BasicMatrixView Column(std::size_t columnIndex) const noexcept;
+	BasicMatrixView Block(std::size_t rowIndex, std::size_t columnIndex,
+		std::size_t rowSize, std::size_t columnSize) const noexcept;
+};
+
+using ConstMatrixView = BasicConstMatrixView<float>;
+using MatrixView = BasicMatrixView<float>;
+
+template<typename Destination, typename Function>
+void TransformRows(Destination&& destination, Function function) {
+	const auto [row, column] = destination.GetSize();
+
+	if (destination.IsContiguous()) {
+		function(row * column, destination.GetData());
+	} else {
+		for (std::size_t i = 0; i < row; ++i) {
+			function(column, destination.GetData() + i * destination.GetStride());
+		}
+	}
+}
+template<typename Destination, typename Source, typename Function>
+void TransformRows(Destination&& destination, const Source& source, Function function) {
+	assert(destination.GetSize() == source.GetSize());
+
+	const auto [row, column] = destination.GetSize();
+
+	if (destination.IsContiguous() && source.IsContiguous()) {
+		function(row * column, source.GetData(), destination.GetData());
+	} else {
+		for (std::size_t i = 0; i < row; ++i) {
+			function(column, source.GetData() + i * source.GetStride(),
+				destination.GetData() + i * destination.GetStride());
+		}
+	}
+}
+template<typename Lhs, typename Rhs, typename Function>
+void VisitRows(const Lhs& lhs, const Rhs& rhs, Function function) {
+	assert(lhs.GetSize() == rhs.GetSize());
+
+	const auto [row, column] = lhs.GetSize();
+
+	if (lhs.IsContiguous() && rhs.IsContiguous()) {
+		function(row * column, lhs.GetData(), rhs.GetData());
+	} else {
+		for (std::size_t i = 0; i < row; ++i) {
+			function(column, lhs.GetData() + i * lhs.GetStride(), rhs.GetData() + i * rhs.GetStride());
+		}
+	}
+}
+
+template<typename T>
+struct IsBasicMatrix : std::false_type {};
+template<typename T>
+struct IsBasicMatrix<BasicMatrix<T>> : std::true_type {};
+
+template<typename T>
+concept MatrixExpression = requires {
+	typename std::remove_cvref_t<T>::IsMatrixExpression;
+};
+
+template<typename T>
+concept MatrixOperand = IsBasicMatrix<std::remove_cvref_t<T>>::value || MatrixExpression<T>;
+
+template<typename T>
+class BasicMatrix final {
+public:
+	using ValueType = T;
+
+private:
+	std::size_t m_RowSize = 0, m_ColumnSize = 0;
+	std::size_t m_Stride = 0;
+	MatrixStorage<T> m_Elements;
+
+public:
+	BasicMatrix() noexcept = default;
+	BasicMatrix(std::size_t rowSize, std::size_t columnSize, T data = T(0));
+	BasicMatrix(std::size_t rowSize, std::size_t columnSize, std::vector<T> elements);
+	explicit BasicMatrix(BasicConstMatrixView<T> view);
+	template<MatrixExpression Expression>
+	BasicMatrix(const Expression& expression);
+	BasicMatrix(const BasicMatrix& other) = default;
+	BasicMatrix(BasicMatrix&& other) noexcept = default;
+	~BasicMatrix() = default;
+
+public:
+	BasicMatrix& operator=(const BasicMatrix& other) = default;
+	BasicMatrix& operator=(BasicMatrix&& other) noexcept = default;
+	template<MatrixExpression Expression>
+	BasicMatrix& operator=(const Expression& expression);
+	bool operator==(const BasicMatrix& other) const noexcept;
+	BasicMatrix operator*(const BasicMatrix& other) const;
+	BasicMatrix& operator+=(const BasicMatrix& other) noexcept;
+	template<MatrixExpression Expression>
+	BasicMatrix& operator+=(const Expression& expression) noexcept;
+	BasicMatrix& operator-=(const BasicMatrix& other) noexcept;
+	template<MatrixExpression Expression>
+	BasicMatrix& operator-=(const Expression& expression) noexcept;
+	BasicMatrix& operator*=(T scalar) noexcept;
+	BasicMatrix& operator*=(const BasicMatrix& other);
+	T operator[](const std::pair<std::size_t, std::size_t>& index) const noexcept;
+	T& operator[](const std::pair<std::size_t, std::size_t>& index) noexcept;
+	T operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept;
+	T& operator()(std::size_t rowIndex, std::size_t columnIndex) noexcept;
+	operator BasicConstMatrixView<T>() const noexcept;
+	operator BasicMatrixView<T>() noexcept;
 
 public:
 	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
 	std::size_t GetRowSize() const noexcept;
 	std::size_t GetColumnSize() const noexcept;
+	void Resize(std::size_t rowSize, std::size_t columnSize);
+	std::size_t GetStride() const noexcept;
+	bool IsContiguous() const noexcept;
 	bool IsZeroMatrix() const noexcept;
+	const T* GetData() const noexcept;
+	T* GetData() noexcept;
+
+	BasicConstMatrixView<T> Row(std::size_t rowIndex) const noexcept;
+	BasicMatrixView<T> Row(std::size_t rowIndex) noexcept;
+	BasicConstMatrixView<T> Column(std::size_t columnIndex) const noexcept;
+	BasicMatrixView<T> Column(std::size_t columnIndex) noexcept;
+	BasicConstMatrixView<T> Block(std::size_t rowIndex, std::size_t columnIndex,
+		std::size_t rowSize, std::size_t columnSize) const noexcept;
+	BasicMatrixView<T> Block(std::size_t rowIndex, std::size_t columnIndex,
+		std::size_t rowSize, std::size_t columnSize) noexcept;
+
+	BasicMatrix& HadamardProduct(const BasicMatrix& other) noexcept;
+	BasicMatrix& Transpose();
+
+private:
+	template<typename Expression, typename Operation>
+	void EvaluateExpression(const Expression& expression, Operation operation) noexcept;
+};
 
-	Matrix& HadamardProduct(const Matrix& other) noexcept;
-	Matrix& Transpose();
+using Matrix = BasicMatrix<float>;
+
+extern template class BasicConstMatrixView<float>;
+extern template class BasicConstMatrixView<double>;
+extern template class BasicMatrixView<float>;
+extern template class BasicMatrixView<double>;
+extern template class BasicMatrix<float>;
+extern template class BasicMatrix<double>;
+
+template<typename T>
+using MatrixExpressionOperand = std::conditional_t<IsBasicMatrix<std::remove_cvref_t<T>>::value,
+	std::conditional_t<std::is_lvalue_reference_v<T>, const std::remove_cvref_t<T>&, std::remove_cvref_t<T>>,
+	std::remove_cvref_t<T>>;
+
+template<typename Operand>
+auto EvaluateMatrixOperand(const Operand& operand, std::size_t rowIndex, std::size_t columnIndex) noexcept {
+	if constexpr (IsBasicMatrix<Operand>::value) {
+		return operand.GetData()[rowIndex * operand.GetStride() + columnIndex];
+	} else {
+		return operand.Evaluate(rowIndex, columnIndex);
+	}
+}
+
+template<typename Lhs, typename Rhs, typename Operation>
+class BinaryMatrixExpression final {
+public:
+	using IsMatrixExpression = void;
+	using ValueType = std::common_type_t<typename std::remove_cvref_t<Lhs>::ValueType,
+		typename std::remove_cvref_t<Rhs>::ValueType>;
+
+private:
+	Lhs m_Lhs;
+	Rhs m_Rhs;
+
+public:
+	template<typename LhsOperand, typename RhsOperand>
+	BinaryMatrixExpression(LhsOperand&& lhs, RhsOperand&& rhs)
+		: m_Lhs(std::forward<LhsOperand>(lhs)), m_Rhs(std::forward<RhsOperand>(rhs)) {
+		assert(m_Lhs.GetSize() == m_Rhs.GetSize());
+	}
+
+public:
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept {
+		return m_Lhs.GetSize();
+	}
+	ValueType Evaluate(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+		return Operation{}(EvaluateMatrixOperand(m_Lhs, rowIndex, columnIndex),
+			EvaluateMatrixOperand(m_Rhs, rowIndex, columnIndex));
+	}
 };
 
-Matrix RandomMatrix(std::size_t rowSize, std::size_t columnSize, float elementMin = -1, float elementMax = 1);
+template<typename Operand>
+class ScaledMatrixExpression final {
+public:
+	using IsMatrixExpression = void;
+	using ValueType = typename std::remove_cvref_t<Operand>::ValueType;
+
+private:
+	ValueType m_Scalar;
+	Operand m_Operand;
+
+public:
+	template<typename OperandType>
+	ScaledMatrixExpression(ValueType scalar, OperandType&& operand)
+		: m_Scalar(scalar), m_Operand(std::forward<OperandType>(operand)) {}
+
+public:
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept {
+		return m_Operand.GetSize();
+	}
+	ValueType Evaluate(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+		return m_Scalar * EvaluateMatrixOperand(m_Operand, rowIndex, columnIndex);
+	}
+};
+
+template<typename T>
+template<MatrixExpression Expression>
+BasicMatrix<T>::BasicMatrix(const Expression& expression) {
+	*this = expression;
+}
+
+template<typename T>
+template<MatrixExpression Expression>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const Expression& expression) {
+	const auto [row, column] = expression.GetSize();
+
+	if (row == 0) return *this = BasicMatrix();
+
+	Resize(row, column);
+
+	EvaluateExpression(expression, [](T, T value) noexcept { return value; });
+
+	return *this;
+}
+template<typename T>
+template<MatrixExpression Expression>
+BasicMatrix<T>& BasicMatrix<T>::operator+=(const Expression& expression) noexcept {
+	assert(GetSize() == expression.GetSize());
+
+	EvaluateExpression(expression, std::plus<>{});
+
+	return *this;
+}
+template<typename T>
+template<MatrixExpression Expression>
+BasicMatrix<T>& BasicMatrix<T>::operator-=(const Expression& expression) noexcept {
+	assert(GetSize() == expression.GetSize());
+
+	EvaluateExpression(expression, std::minus<>{});
+
+	return *this;
+}
+
+template<typename T>
+template<typename Expression, typename Operation>
+void BasicMatrix<T>::EvaluateExpression(const Expression& expression, Operation operation) noexcept {
+	for (std::size_t i = 0; i < m_RowSize; ++i) {
+		T* const row = m_Elements.data() + i * m_Stride;
+
+		for (std::size_t j = 0; j < m_ColumnSize; ++j) {
+			row[j] = static_cast<T>(operation(row[j], expression.Evaluate(i, j)));
+		}
+	}
+}
+
+template<MatrixOperand Lhs, MatrixOperand Rhs>
+auto operator+(Lhs&& lhs, Rhs&& rhs) {
+	return BinaryMatrixExpression<MatrixExpressionOperand<Lhs>, MatrixExpressionOperand<Rhs>, std::plus<>>(
+		std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+template<MatrixOperand Lhs, MatrixOperand Rhs>
+auto operator-(Lhs&& lhs, Rhs&& rhs) {
+	return BinaryMatrixExpression<MatrixExpressionOperand<Lhs>, MatrixExpressionOperand<Rhs>, std::minus<>>(
+		std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+template<MatrixOperand Operand>
+auto operator*(typename std::remove_cvref_t<Operand>::ValueType scalar, Operand&& operand) {
+	return ScaledMatrixExpression<MatrixExpressionOperand<Operand>>(scalar, std::forward<Operand>(operand));
+}
+template<MatrixOperand Operand>
+auto operator*(Operand&& operand, typename std::remove_cvref_t<Operand>::ValueType scalar) {
+	return ScaledMatrixExpression<MatrixExpressionOperand<Operand>>(scalar, std::forward<Operand>(operand));
+}
+template<MatrixOperand Lhs, MatrixOperand Rhs>
+	requires (MatrixExpression<Lhs> || MatrixExpression<Rhs>)
+auto operator*(Lhs&& lhs, Rhs&& rhs) {
+	using ValueType = std::common_type_t<typename std::remove_cvref_t<Lhs>::ValueType,
+		typename std::remove_cvref_t<Rhs>::ValueType>;
+
+	return BasicMatrix<ValueType>(std::forward<Lhs>(lhs)) * BasicMatrix<ValueType>(std::forward<Rhs>(rhs));
+}
+
+template<MatrixOperand Lhs, MatrixOperand Rhs>
+auto HadamardProduct(Lhs&& lhs, Rhs&& rhs) {
+	return BinaryMatrixExpression<MatrixExpressionOperand<Lhs>, MatrixExpressionOperand<Rhs>, std::multiplies<>>(
+		std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+class CompactMatrix final {
+private:
+	std::size_t m_RowSize = 0, m_ColumnSize = 0;
+	MatrixPrecision m_Precision = MatrixPrecision::BFloat16;
+	MatrixStorage<std::uint16_t> m_Elements;
+
+public:
+	CompactMatrix() noexcept = default;
+	CompactMatrix(ConstMatrixView matrix, MatrixPrecision precision);
+	CompactMatrix(const CompactMatrix& other) = default;
+	CompactMatrix(CompactMatrix&& other) noexcept = default;
+	~CompactMatrix() = default;
+
+public:
+	CompactMatrix& operator=(const CompactMatrix& other) = default;
+	CompactMatrix& operator=(CompactMatrix&& other) noexcept = default;
+	float operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept;
+
+public:
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
+	std::size_t GetRowSize() const noexcept;
+	std::size_t GetColumnSize() const noexcept;
+	MatrixPrecision GetPrecision() const noexcept;
+	bool IsEmpty() const noexcept;
+	const std::uint16_t* GetData() const noexcept;
+
+	void Assign(ConstMatrixView matrix, MatrixPrecision precision);
+	void Expand(MatrixView destination) const noexcept;
+	Matrix Expand() const;
+};
+
+class QuantizedMatrix final {
+private:
+	std::size_t m_RowSize = 0, m_ColumnSize = 0;
+	std::vector<float> m_Scales;
+	MatrixStorage<std::int8_t> m_Elements;
+
+public:
+	QuantizedMatrix() noexcept = default;
+	explicit QuantizedMatrix(ConstMatrixView matrix);
+	QuantizedMatrix(const QuantizedMatrix& other) = default;
+	QuantizedMatrix(QuantizedMatrix&& other) noexcept = default;
+	~QuantizedMatrix() = default;
+
+public:
+	QuantizedMatrix& operator=(const QuantizedMatrix& other) = default;
+	QuantizedMatrix& operator=(QuantizedMatrix&& other) noexcept = default;
+	float operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept;
+
+public:
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
+	std::size_t GetRowSize() const noexcept;
+	std::size_t GetColumnSize() const noexcept;
+	bool IsEmpty() const noexcept;
+	const std::int8_t* GetData() const noexcept;
+	const float* GetScales() const noexcept;
+
+	void Assign(ConstMatrixView matrix);
+	void AssignTransposed(ConstMatrixView matrix, const std::vector<float>& rowScales);
+	Matrix Expand() const;
+};
+
+enum class SparseMatrixFormat {
+	CSR,
+	CSC,
+};
+
+class SparseMatrix final {
+private:
+	std::size_t m_RowSize = 0, m_ColumnSize = 0;
+	SparseMatrixFormat m_Format = SparseMatrixFormat::CSC;
+	std::vector<std::size_t> m_Offsets;
+	std::vector<std::size_t> m_Indices;
+	std::vector<float> m_Values;
+
+public:
+	SparseMatrix() noexcept = default;
+	SparseMatrix(std::size_t rowSize, std::size_t columnSize, SparseMatrixFormat format = SparseMatrixFormat::CSC);
+	SparseMatrix(std::size_t rowSize, std::size_t columnSize, SparseMatrixFormat format,
+		std::vector<std::size_t> offsets, std::vector<std::size_t> indices, std::vector<float> values);
+	explicit SparseMatrix(ConstMatrixView matrix, SparseMatrixFormat format = SparseMatrixFormat::CSC);
+	SparseMatrix(const SparseMatrix& other) = default;
+	SparseMatrix(SparseMatrix&& other) noexcept = default;
+	~SparseMatrix() = default;
+
+public:
+	SparseMatrix& operator=(const SparseMatrix& other) = default;
+	SparseMatrix& operator=(SparseMatrix&& other) noexcept = default;
+	float operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept;
+
+public:
+	std::pair<std::size_t, std::size_t> GetSize() const noexcept;
+	std::size_t GetRowSize() const noexcept;
+	std::size_t GetColumnSize() const noexcept;
+	SparseMatrixFormat GetFormat() const noexcept;
+	std::size_t GetNonZeroCount() const noexcept;
+	const std::size_t* GetOffsets() const noexcept;
+	const std::size_t* GetIndices() const noexcept;
+	const float* GetValues() const noexcept;
+
+	void Assign(ConstMatrixView matrix, SparseMatrixFormat format = SparseMatrixFormat::CSC);
+	void ConvertFormat(SparseMatrixFormat newFormat);
+	void Expand(MatrixView result) const noexcept;
+	Matrix Expand() const;
+};
+
+template<typename T = float>
+BasicMatrix<T> RandomMatrix(std::size_t rowSize, std::size_t columnSize,
+	std::type_identity_t<T> elementMin = -1, std::type_identity_t<T> elementMax = 1);
+
+template<typename T>
+std::ostream& operator<<(std::ostream& stream, const BasicMatrix<T>& matrix);
+
+template<typename T>
+BasicMatrix<T> Transpose(const BasicMatrix<T>& matrix);
+Matrix MultiplyTransposedLhs(ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix);
+Matrix MultiplyTransposedRhs(ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix);
+Matrix ReferenceMultiply(ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix);
+BasicMatrix<double> MultiplyTransposedLhs(BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix);
+BasicMatrix<double> MultiplyTransposedRhs(BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix);
+BasicMatrix<double> ReferenceMultiply(BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix);
 
-Matrix operator*(float scalar, const Matrix& matrix);
-std::ostream& operator<<(std::ostream& stream, const Matrix& matrix);
+void Copy(MatrixView destination, ConstMatrixView source) noexcept;
+void Transpose(MatrixView destination, ConstMatrixView source) noexcept;
+void Add(MatrixView destination, ConstMatrixView source) noexcept;
+void Subtract(MatrixView destination, ConstMatrixView source) noexcept;
+void Scale(MatrixView destination, float scalar) noexcept;
+void Axpy(MatrixView destination, float alpha, ConstMatrixView source) noexcept;
+void AddColumnVector(MatrixView destination, ConstMatrixView columnVector) noexcept;
+void AddRowVector(MatrixView destination, ConstMatrixView rowVector) noexcept;
+void SumRows(MatrixView result, ConstMatrixView matrix) noexcept;
+void SumColumns(MatrixView result, ConstMatrixView matrix) noexcept;
+void Gemm(MatrixView result, ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void GemmTransposedLhs(MatrixView result, ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void GemmTransposedRhs(MatrixView result, ConstMatrixView lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void Gemm(MatrixView result, const CompactMatrix& lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void GemmTransposedLhs(MatrixView result, const CompactMatrix& lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void Gemm(MatrixView result, ConstMatrixView lhsMatrix, const SparseMatrix& rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void Gemm(MatrixView result, const SparseMatrix& lhsMatrix, ConstMatrixView rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void GemmTransposedRhs(MatrixView result, ConstMatrixView lhsMatrix, const SparseMatrix& rhsMatrix,
+	float alpha = 1.f, float beta = 0.f);
+void QuantizedGemm(MatrixView result, const QuantizedMatrix& lhsMatrix, const QuantizedMatrix& transposedRhsMatrix,
+	ConstMatrixView bias, const std::function<void(MatrixView)>& epilogue = nullptr);
 
-Matrix HadamardProduct(const Matrix& lhsMatrix, const Matrix& rhsMatrix);
-Matrix Transpose(const Matrix& matrix);
\ No newline at end of file
+void Copy(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept;
+void Transpose(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept;
+void Add(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept;
+void Subtract(BasicMatrixView<double> destination, BasicConstMatrixView<double> source) noexcept;
+void Scale(BasicMatrixView<double> destination, double scalar) noexcept;
+void Axpy(BasicMatrixView<double> destination, double alpha, BasicConstMatrixView<double> source) noexcept;
+void AddColumnVector(BasicMatrixView<double> destination, BasicConstMatrixView<double> columnVector) noexcept;
+void AddRowVector(BasicMatrixView<double> destination, BasicConstMatrixView<double> rowVector) noexcept;
+void SumRows(BasicMatrixView<double> result, BasicConstMatrixView<double> matrix) noexcept;
+void SumColumns(BasicMatrixView<double> result, BasicConstMatrixView<double> matrix) noexcept;
+void Gemm(BasicMatrixView<double> result, BasicConstMatrixView<double> lhsMatrix, BasicConstMatrixView<double> rhsMatrix,
+	double alpha = 1., double beta = 0.);
+void GemmTransposedLhs(BasicMatrixView<double> result, BasicConstMatrixView<double> lhsMatrix,
+	BasicConstMatrixView<double> rhsMatrix, double alpha = 1., double beta = 0.);
+void GemmTransposedRhs(BasicMatrixView<double> result, BasicConstMatrixView<double> lhsMatrix,
+	BasicConstMatrixView<double> rhsMatrix, double alpha = 1., double beta = 0.);
\ No newline at end of file
@@ -0,0 +1,222 @@
+#include "MatrixAllocator.hpp"
+
+#include "PALMemory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+
+void* MatrixAllocator::Allocate(std::size_t& byteCount) {
+	void* const pointer = AllocateImpl(byteCount);
+
+	m_AllocatedBytes.fetch_add(byteCount, std::memory_order_relaxed);
+
+	return pointer;
+}
+void MatrixAllocator::Deallocate(void* pointer, std::size_t byteCount) noexcept {
+	if (pointer == nullptr) return;
+
+	DeallocateImpl(pointer, byteCount);
+
+	m_AllocatedBytes.fetch_sub(byteCount, std::memory_order_relaxed);
+}
+std::size_t MatrixAllocator::GetAllocatedBytes() const noexcept {
+	return m_AllocatedBytes.load(std::memory_order_relaxed);
+}
+
+std::size_t MatrixAllocator::GetRowStride(std::size_t columnSize) const noexcept {
+	return columnSize;
+}
+
+namespace {
+	constexpr std::size_t g_MinPoolBucketIndex = std::bit_width(AlignedMatrixAllocator::Alignment - 1);
+	constexpr std::size_t g_PoolBucketCount = std::bit_width(AlignedMatrixAllocator::MaxPooledByteCount - 1) + 1;
+
+	std::size_t GetPoolBucketIndex(std::size_t byteCount) noexcept {
+		return std::max<std::size_t>(std::bit_width(byteCount - 1), g_MinPoolBucketIndex);
+	}
+	bool IsPooledByteCount(std::size_t byteCount) noexcept {
+		return byteCount > 0 && byteCount <= AlignedMatrixAllocator::MaxPooledByteCount;
+	}
+	bool IsPoolBucketByteCount(std::size_t byteCount) noexcept {
+		return byteCount >= AlignedMatrixAllocator::Alignment && std::has_single_bit(byteCount) &&
+			byteCount <= AlignedMatrixAllocator::MaxPooledByteCount;
+	}
+
+	std::atomic<std::size_t> g_PooledBytes = 0;
+	thread_local bool g_IsBufferPoolDestroyed = false;
+
+	class BufferPool final {
+	private:
+		std::array<std::array<void*, AlignedMatrixAllocator::MaxPooledBufferCount>, g_PoolBucketCount> m_Buffers{};
+		std::array<std::size_t, g_PoolBucketCount> m_BufferCounts{};
+
+	public:
+		BufferPool() noexcept = default;
+		BufferPool(const BufferPool&) = delete;
+		~BufferPool() {
+			Release();
+
+			g_IsBufferPoolDestroyed = true;
+		}
+
+	public:
+		BufferPool& operator=(const BufferPool&) = delete;
+
+	public:
+		void* Pop(std::size_t bucketIndex) noexcept {
+			std::size_t& bufferCount = m_BufferCounts[bucketIndex];
+			if (bufferCount == 0) return nullptr;
+
+			return m_Buffers[bucketIndex][--bufferCount];
+		}
+		bool Push(std::size_t bucketIndex, void* pointer, std::size_t maxPooledBytes) noexcept {
+			std::size_t& bufferCount = m_BufferCounts[bucketIndex];
+			if (bufferCount == AlignedMatrixAllocator::MaxPooledBufferCount) return false;
+
+			const std::size_t byteCount = std::size_t(1) << bucketIndex;
+			if (g_PooledBytes.fetch_add(byteCount, std::memory_order_relaxed) + byteCount > maxPooledBytes) {
+				g_PooledBytes.fetch_sub(byteCount, std::memory_order_relaxed);
+
+				return false;
+			}
+
+			m_Buffers[bucketIndex][bufferCount++] = pointer;
+
+			return true;
+		}
+		void Trim(std::size_t maxPooledBytes) noexcept {
+			for (std::size_t i = g_PoolBucketCount; i-- > 0;) {
+				while (m_BufferCounts[i] > 0 && g_PooledBytes.load(std::memory_order_relaxed) > maxPooledBytes) {
+					DeallocateAlignedMemory(m_Buffers[i][--m_BufferCounts[i]]);
+					g_PooledBytes.fetch_sub(std::size_t(1) << i, std::memory_order_relaxed);
+				}
+			}
+		}
+		void Release() noexcept {
+			for (std::size_t i = 0; i < g_PoolBucketCount; ++i) {
+				for (std::size_t j = 0; j < m_BufferCounts[i]; ++j) {
+					DeallocateAlignedMemory(m_Buffers[i][j]);
+				}
+
+				g_PooledBytes.fetch_sub(m_BufferCounts[i] << i, std::memory_order_relaxed);
+				m_BufferCounts[i] = 0;
+			}
+		}
+	};
+
+	thread_local BufferPool g_BufferPool;
+}
+
+bool AlignedMatrixAllocator::IsRowPaddingEnabled() const noexcept {
+	return m_IsRowPaddingEnabled.load(std::memory_order_relaxed);
+}
+void AlignedMatrixAllocator::SetRowPaddingEnabled(bool newIsRowPaddingEnabled) noexcept {
+	m_IsRowPaddingEnabled.store(newIsRowPaddingEnabled, std::memory_order_relaxed);
+}
+std::size_t AlignedMatrixAllocator::GetHugePageThreshold() const noexcept {
+	return m_HugePageThreshold.load(std::memory_order_relaxed);
+}
+void AlignedMatrixAllocator::SetHugePageThreshold(std::size_t newHugePageThreshold) noexcept {
+	m_HugePageThreshold.store(newHugePageThreshold, std::memory_order_relaxed);
+}
+bool AlignedMatrixAllocator::IsBufferPoolEnabled() const noexcept {
+	return m_IsBufferPoolEnabled.load(std::memory_order_relaxed);
+}
+void AlignedMatrixAllocator::SetBufferPoolEnabled(bool newIsBufferPoolEnabled) noexcept {
+	m_IsBufferPoolEnabled.store(newIsBufferPoolEnabled, std::memory_order_relaxed);
+
+	if (!newIsBufferPoolEnabled) {
+		ReleasePooledBuffers();
+	}
+}
+std::size_t AlignedMatrixAllocator::GetMaxPooledTotalByteCount() const noexcept {
+	return m_MaxPooledTotalByteCount.load(std::memory_order_relaxed);
+}
+void AlignedMatrixAllocator::SetMaxPooledTotalByteCount(std::size_t newMaxPooledTotalByteCount) noexcept {
+	m_MaxPooledTotalByteCount.store(newMaxPooledTotalByteCount, std::memory_order_relaxed);
+
+	TrimPooledBuffers();
+}
+std::size_t AlignedMatrixAllocator::GetPooledBytes() noexcept {
+	return g_PooledBytes.load(std::memory_order_relaxed);
+}
+std::size_t AlignedMatrixAllocator::GetPoolHitCount() const noexcept {
+	return m_PoolHitCount.load(std::memory_order_relaxed);
+}
+std::size_t AlignedMatrixAllocator::GetPoolMissCount() const noexcept {
+	return m_PoolMissCount.load(std::memory_order_relaxed);
+}
+void AlignedMatrixAllocator::ResetPoolCounters() noexcept {
+	m_PoolHitCount.store(0, std::memory_order_relaxed);
+	m_PoolMissCount.store(0, std::memory_order_relaxed);
+}
+void AlignedMatrixAllocator::TrimPooledBuffers() const noexcept {
+	if (!g_IsBufferPoolDestroyed) {
+		g_BufferPool.Trim(GetMaxPooledTotalByteCount());
+	}
+}
+void AlignedMatrixAllocator::ReleasePooledBuffers() noexcept {
+	if (!g_IsBufferPoolDestroyed) {
+		g_BufferPool.Release();
+	}
+}
+
+std::size_t AlignedMatrixAllocator::GetRowStride(std::size_t columnSize) const noexcept {
+	constexpr std::size_t lineSize = Alignment / sizeof(float);
+
+	if (!IsRowPaddingEnabled() || columnSize < lineSize) return columnSize;
+
+	return (columnSize + lineSize - 1) / lineSize * lineSize;
+}
+
+void* AlignedMatrixAllocator::AllocateImpl(std::size_t& byteCount) {
+	if (IsPooledByteCount(byteCount) && IsBufferPoolEnabled() && !g_IsBufferPoolDestroyed) {
+		const std::size_t bucketIndex = GetPoolBucketIndex(byteCount);
+
+		byteCount = std::size_t(1) << bucketIndex;
+
+		if (void* const pointer = g_BufferPool.Pop(bucketIndex); pointer != nullptr) {
+			g_PooledBytes.fetch_sub(byteCount, std::memory_order_relaxed);
+			m_PoolHitCount.fetch_add(1, std::memory_order_relaxed);
+
+			return pointer;
+		}
+
+		m_PoolMissCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	const bool useHugePages = byteCount >= GetHugePageThreshold();
+	const std::size_t alignment = useHugePages ? HugePageSize : Alignment;
+	const std::size_t alignedByteCount = (byteCount + alignment - 1) / alignment * alignment;
+	void* const pointer = AllocateAlignedMemory(alignedByteCount, alignment, useHugePages);
+
+	byteCount = alignedByteCount;
+
+	return pointer;
+}
+void AlignedMatrixAllocator::DeallocateImpl(void* pointer, std::size_t byteCount) noexcept {
+	if (IsPoolBucketByteCount(byteCount) && IsBufferPoolEnabled() && !g_IsBufferPoolDestroyed &&
+		g_BufferPool.Push(GetPoolBucketIndex(byteCount), pointer, GetMaxPooledTotalByteCount())) return;
+
+	DeallocateAlignedMemory(pointer);
+}
+
+namespace {
+	std::atomic<MatrixAllocator*> g_MatrixAllocator = nullptr;
+}
+
+AlignedMatrixAllocator& GetDefaultMatrixAllocator() noexcept {
+	static AlignedMatrixAllocator allocator;
+
+	return allocator;
+}
+MatrixAllocator& GetMatrixAllocator() noexcept {
+	MatrixAllocator* const allocator = g_MatrixAllocator.load(std::memory_order_acquire);
+
+	return allocator ? *allocator : GetDefaultMatrixAllocator();
+}
+void SetMatrixAllocator(MatrixAllocator* allocator) noexcept {
+	g_MatrixAllocator.store(allocator, std::memory_order_release);
+}
\ No newline at end of file
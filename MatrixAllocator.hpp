@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#ifndef SAM_MATRIX_INLINE_CAPACITY
+#	define SAM_MATRIX_INLINE_CAPACITY 16
+#endif
+
+inline constexpr std::size_t MatrixInlineCapacity = SAM_MATRIX_INLINE_CAPACITY;
+
+class MatrixAllocator {
+private:
+	std::atomic<std::size_t> m_AllocatedBytes = 0;
+
+public:
+	MatrixAllocator() noexcept = default;
+	MatrixAllocator(const MatrixAllocator&) = delete;
+	virtual ~MatrixAllocator() = default;
+
+public:
+	MatrixAllocator& operator=(const MatrixAllocator&) = delete;
+
+public:
+	void* Allocate(std::size_t& byteCount);
+	void Deallocate(void* pointer, std::size_t byteCount) noexcept;
+	std::size_t GetAllocatedBytes() const noexcept;
+
+	virtual std::size_t GetRowStride(std::size_t columnSize) const noexcept;
+
+protected:
+	virtual void* AllocateImpl(std::size_t& byteCount) = 0;
+	virtual void DeallocateImpl(void* pointer, std::size_t byteCount) noexcept = 0;
+};
+
+class AlignedMatrixAllocator final : public MatrixAllocator {
+public:
+	static constexpr std::size_t Alignment = 64;
+	static constexpr std::size_t HugePageSize = 2 * 1024 * 1024;
+	static constexpr std::size_t MaxPooledByteCount = 64 * 1024 * 1024;
+	static constexpr std::size_t MaxPooledBufferCount = 8;
+	static constexpr std::size_t DefaultMaxPooledTotalByteCount = 256 * 1024 * 1024;
+
+private:
+	std::atomic<bool> m_IsRowPaddingEnabled = false;
+	std::atomic<std::size_t> m_HugePageThreshold = HugePageSize;
+	std::atomic<bool> m_IsBufferPoolEnabled = true;
+	std::atomic<std::size_t> m_MaxPooledTotalByteCount = DefaultMaxPooledTotalByteCount;
+	std::atomic<std::size_t> m_PoolHitCount = 0, m_PoolMissCount = 0;
+
+public:
+	AlignedMatrixAllocator() noexcept = default;
+	AlignedMatrixAllocator(const AlignedMatrixAllocator&) = delete;
+	virtual ~AlignedMatrixAllocator() override = default;
+
+public:
+	AlignedMatrixAllocator& operator=(const AlignedMatrixAllocator&) = delete;
+
+public:
+	bool IsRowPaddingEnabled() const noexcept;
+	void SetRowPaddingEnabled(bool newIsRowPaddingEnabled) noexcept;
+	std::size_t GetHugePageThreshold() const noexcept;
+	void SetHugePageThreshold(std::size_t newHugePageThreshold) noexcept;
+	bool IsBufferPoolEnabled() const noexcept;
+	void SetBufferPoolEnabled(bool newIsBufferPoolEnabled) noexcept;
+	std::size_t GetMaxPooledTotalByteCount() const noexcept;
+	void SetMaxPooledTotalByteCount(std::size_t newMaxPooledTotalByteCount) noexcept;
+	static std::size_t GetPooledBytes() noexcept;
+	std::size_t GetPoolHitCount() const noexcept;
+	std::size_t GetPoolMissCount() const noexcept;
+	void ResetPoolCounters() noexcept;
+	void TrimPooledBuffers() const noexcept;
+	static void ReleasePooledBuffers() noexcept;
+
+	virtual std::size_t GetRowStride(std::size_t columnSize) const noexcept override;
+
+protected:
+	virtual void* AllocateImpl(std::size_t& byteCount) override;
+	virtual void DeallocateImpl(void* pointer, std::size_t byteCount) noexcept override;
+};
+
+AlignedMatrixAllocator& GetDefaultMatrixAllocator() noexcept;
+MatrixAllocator& GetMatrixAllocator() noexcept;
+void SetMatrixAllocator(MatrixAllocator* allocator) noexcept;
+
+template<typename T>
+class MatrixStorageAllocator final {
+private:
+	MatrixAllocator* m_Allocator;
+
+public:
+	MatrixStorageAllocator() noexcept
+		: m_Allocator(&GetMatrixAllocator()) {}
+	MatrixStorageAllocator(const MatrixStorageAllocator& other) noexcept = default;
+	~MatrixStorageAllocator() = default;
+
+public:
+	MatrixStorageAllocator& operator=(const MatrixStorageAllocator& other) noexcept = default;
+
+public:
+	T* allocate(std::size_t& count) {
+		std::size_t byteCount = count * sizeof(T);
+		T* const pointer = static_cast<T*>(m_Allocator->Allocate(byteCount));
+
+		count = byteCount / sizeof(T);
+
+		return pointer;
+	}
+	void deallocate(T* pointer, std::size_t count) noexcept {
+		m_Allocator->Deallocate(pointer, count * sizeof(T));
+	}
+};
+
+template<typename T>
+class MatrixStorage final {
+	static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+	static constexpr std::size_t InlineCapacity =
+		std::max<std::size_t>(MatrixInlineCapacity * sizeof(float) / sizeof(T), 1);
+
+private:
+	MatrixStorageAllocator<T> m_Allocator;
+	T* m_Data = m_InlineElements;
+	std::size_t m_Size = 0, m_Capacity = InlineCapacity;
+	alignas(AlignedMatrixAllocator::Alignment) T m_InlineElements[InlineCapacity];
+
+public:
+	MatrixStorage() noexcept = default;
+	MatrixStorage(std::size_t size, T value) {
+		Reserve(size);
+
+		std::fill_n(m_Data, size, value);
+		m_Size = size;
+	}
+	MatrixStorage(const MatrixStorage& other) {
+		Reserve(other.m_Size);
+
+		std::copy_n(other.m_Data, other.m_Size, m_Data);
+		m_Size = other.m_Size;
+	}
+	MatrixStorage(MatrixStorage&& other) noexcept {
+		*this = std::move(other);
+	}
+	~MatrixStorage() {
+		Release();
+	}
+
+public:
+	MatrixStorage& operator=(const MatrixStorage& other) {
+		if (this == &other) return *this;
+
+		if (other.m_Size > m_Capacity) {
+			Release();
+			Reserve(other.m_Size);
+		}
+
+		std::copy_n(other.m_Data, other.m_Size, m_Data);
+		m_Size = other.m_Size;
+
+		return *this;
+	}
+	MatrixStorage& operator=(MatrixStorage&& other) noexcept {
+		if (this == &other) return *this;
+
+		if (other.IsInline()) {
+			std::copy_n(other.m_Data, other.m_Size, m_Data);
+		} else {
+			Release();
+
+			m_Allocator = other.m_Allocator;
+			m_Data = std::exchange(other.m_Data, other.m_InlineElements);
+			m_Capacity = std::exchange(other.m_Capacity, InlineCapacity);
+		}
+
+		m_Size = std::exchange(other.m_Size, 0);
+
+		return *this;
+	}
+	T operator[](std::size_t index) const noexcept {
+		return m_Data[index];
+	}
+	T& operator[](std::size_t index) noexcept {
+		return m_Data[index];
+	}
+
+public:
+	const T* data() const noexcept {
+		return m_Data;
+	}
+	T* data() noexcept {
+		return m_Data;
+	}
+	std::size_t size() const noexcept {
+		return m_Size;
+	}
+	bool empty() const noexcept {
+		return m_Size == 0;
+	}
+	bool IsInline() const noexcept {
+		return m_Data == m_InlineElements;
+	}
+
+	void resize(std::size_t newSize) {
+		if (newSize > m_Capacity) {
+			std::size_t newCapacity = newSize;
+			T* const newData = m_Allocator.allocate(newCapacity);
+
+			std::copy_n(m_Data, m_Size, newData);
+			Release();
+
+			m_Data = newData;
+			m_Capacity = newCapacity;
+		}
+		if (newSize > m_Size) {
+			std::fill(m_Data + m_Size, m_Data + newSize, T());
+		}
+
+		m_Size = newSize;
+	}
+	void Reset() noexcept {
+		Release();
+
+		m_Size = 0;
+	}
+private:
+	void Reserve(std::size_t capacity) {
+		if (capacity <= m_Capacity) return;
+
+		m_Data = m_Allocator.allocate(capacity);
+		m_Capacity = capacity;
+	}
+	void Release() noexcept {
+		if (IsInline()) return;
+
+		m_Allocator.deallocate(m_Data, m_Capacity);
+		m_Data = m_InlineElements;
+		m_Capacity = InlineCapacity;
+	}
+};
\ No newline at end of file
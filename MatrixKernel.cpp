@@ -0,0 +1,579 @@
+#include "MatrixKernel.hpp"
+
+#include "HalfFloat.hpp"
+#include "ThreadPool.hpp"
+#include "VectorKernel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+	constexpr std::size_t SmallGemmThreshold = 32 * 32 * 32;
+	constexpr std::size_t QuantizedMC = 32;
+
+	std::atomic<std::size_t> g_MicroTileIndex = 1;
+	std::atomic<std::size_t> g_MC = 128, g_KC = 256, g_NC = 2048;
+	std::atomic<std::size_t> g_ParallelGemmThreshold = 128 * 128 * 128;
+
+	constexpr std::size_t FindMicroTileIndex(std::size_t mr, std::size_t nr) noexcept {
+		const auto iterator = std::ranges::find(GemmMicroTileSizes, std::make_pair(mr, nr));
+
+		return static_cast<std::size_t>(iterator - GemmMicroTileSizes.begin());
+	}
+	std::size_t RoundUp(std::size_t value, std::size_t multiple) noexcept {
+		return (value + multiple - 1) / multiple * multiple;
+	}
+
+	template<float(*Convert)(std::uint16_t) noexcept>
+	class CompactPointer final {
+	private:
+		const std::uint16_t* m_Pointer;
+
+	public:
+		explicit CompactPointer(const std::uint16_t* pointer) noexcept
+			: m_Pointer(pointer) {}
+
+	public:
+		float operator[](std::size_t index) const noexcept {
+			return Convert(m_Pointer[index]);
+		}
+		CompactPointer operator+(std::size_t offset) const noexcept {
+			return CompactPointer(m_Pointer + offset);
+		}
+	};
+
+	template<std::size_t MR, typename T, typename PointerA>
+	void PackA(bool transposeA, std::size_t mc, std::size_t kc, PointerA a, std::size_t lda,
+		T* packed) noexcept {
+		for (std::size_t i = 0; i < mc; i += MR) {
+			const std::size_t mr = std::min(MR, mc - i);
+
+			if (transposeA) {
+				for (std::size_t p = 0; p < kc; ++p) {
+					const PointerA column = a + p * lda + i;
+
+					for (std::size_t ii = 0; ii < mr; ++ii) {
+						packed[p * MR + ii] = column[ii];
+					}
+				}
+			} else if constexpr (std::is_same_v<PointerA, const float*>) {
+				TransposeKernel(mr, kc, a + i * lda, lda, packed, MR);
+			} else {
+				for (std::size_t ii = 0; ii < mr; ++ii) {
+					const PointerA row = a + (i + ii) * lda;
+
+					for (std::size_t p = 0; p < kc; ++p) {
+						packed[p * MR + ii] = row[p];
+					}
+				}
+			}
+
+			for (std::size_t p = 0; p < kc; ++p) {
+				for (std::size_t ii = mr; ii < MR; ++ii) {
+					packed[p * MR + ii] = T(0);
+				}
+			}
+
+			packed += MR * kc;
+		}
+	}
+	template<std::size_t NR, typename T>
+	void PackB(bool transposeB, std::size_t kc, std::size_t nc, const T* b, std::size_t ldb,
+		T* packed) noexcept {
+		const std::size_t depthStride = transposeB ? 1 : ldb;
+		const std::size_t columnStride = transposeB ? ldb : 1;
+
+		for (std::size_t j = 0; j < nc; j += NR) {
+			const std::size_t nr = std::min(NR, nc - j);
+
+			for (std::size_t p = 0; p < kc; ++p) {
+				const T* const row = b + p * depthStride + j * columnStride;
+
+				for (std::size_t jj = 0; jj < nr; ++jj) {
+					packed[jj] = row[jj * columnStride];
+				}
+				for (std::size_t jj = nr; jj < NR; ++jj) {
+					packed[jj] = T(0);
+				}
+
+				packed += NR;
+			}
+		}
+	}
+
+	template<std::size_t MR, std::size_t NR, typename T>
+	void MicroKernel(std::size_t kc, T alpha, const T* packedA, const T* packedB,
+		T* c, std::size_t ldc, std::size_t mr, std::size_t nr) noexcept {
+		T acc[MR][NR] = {};
+
+		for (std::size_t p = 0; p < kc; ++p) {
+			for (std::size_t i = 0; i < MR; ++i) {
+				const T aip = packedA[i];
+
+				for (std::size_t j = 0; j < NR; ++j) {
+					acc[i][j] += aip * packedB[j];
+				}
+			}
+
+			packedA += MR;
+			packedB += NR;
+		}
+
+		for (std::size_t i = 0; i < mr; ++i) {
+			for (std::size_t j = 0; j < nr; ++j) {
+				c[i * ldc + j] += alpha * acc[i][j];
+			}
+		}
+	}
+	template<std::size_t MR, std::size_t NR>
+	void MicroKernel(std::size_t kc, float alpha, const float* packedA, const float* packedB,
+		float* c, std::size_t ldc, std::size_t mr, std::size_t nr) noexcept {
+		constexpr std::size_t microTileIndex = FindMicroTileIndex(MR, NR);
+
+		if (mr == MR && nr == NR) {
+			GemmMicroKernel(microTileIndex, kc, alpha, packedA, packedB, c, ldc);
+
+			return;
+		}
+
+		float tile[MR * NR] = {};
+
+		GemmMicroKernel(microTileIndex, kc, alpha, packedA, packedB, tile, NR);
+
+		for (std::size_t i = 0; i < mr; ++i) {
+			for (std::size_t j = 0; j < nr; ++j) {
+				c[i * ldc + j] += tile[i * NR + j];
+			}
+		}
+	}
+
+	template<typename T, typename PointerA>
+	void SmallGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		T alpha, PointerA a, std::size_t lda, const T* b, std::size_t ldb,
+		T* c, std::size_t ldc) noexcept {
+		const std::size_t aRowStride = transposeA ? 1 : lda;
+		const std::size_t aDepthStride = transposeA ? lda : 1;
+
+		for (std::size_t i = 0; i < m; ++i) {
+			const PointerA aRow = a + i * aRowStride;
+			T* const cRow = c + i * ldc;
+
+			if (transposeB) {
+				for (std::size_t j = 0; j < n; ++j) {
+					const T* const bColumn = b + j * ldb;
+					T sum = T(0);
+
+					for (std::size_t p = 0; p < k; ++p) {
+						sum += aRow[p * aDepthStride] * bColumn[p];
+					}
+
+					cRow[j] += alpha * sum;
+				}
+			} else {
+				for (std::size_t p = 0; p < k; ++p) {
+					const T aip = alpha * aRow[p * aDepthStride];
+					const T* const bRow = b + p * ldb;
+
+					for (std::size_t j = 0; j < n; ++j) {
+						cRow[j] += aip * bRow[j];
+					}
+				}
+			}
+		}
+	}
+
+	template<typename T>
+	void ScaleMatrix(std::size_t m, std::size_t n, T beta, T* c, std::size_t ldc) noexcept {
+		if (beta == T(1)) return;
+
+		for (std::size_t i = 0; i < m; ++i) {
+			if (beta == T(0)) {
+				std::fill_n(c + i * ldc, n, T(0));
+			} else {
+				ScaleKernel(n, beta, c + i * ldc);
+			}
+		}
+	}
+
+	template<std::size_t MR, std::size_t NR, typename T, typename PointerA>
+	void TiledGemmKernel(const GemmParameters& parameters, bool transposeA, bool transposeB,
+		std::size_t m, std::size_t n, std::size_t k, T alpha, PointerA a, std::size_t lda, const T* b, std::size_t ldb,
+		T* c, std::size_t ldc) {
+		thread_local std::vector<T> packedA, packedB;
+
+		const std::size_t MC = RoundUp(parameters.MC, MR), KC = parameters.KC, NC = RoundUp(parameters.NC, NR);
+
+		packedA.resize(MC * KC);
+		packedB.resize(KC * RoundUp(std::min(NC, n), NR));
+
+		for (std::size_t jc = 0; jc < n; jc += NC) {
+			const std::size_t nc = std::min(NC, n - jc);
+
+			for (std::size_t pc = 0; pc < k; pc += KC) {
+				const std::size_t kc = std::min(KC, k - pc);
+
+				PackB<NR>(transposeB, kc, nc, transposeB ? b + jc * ldb + pc : b + pc * ldb + jc, ldb, packedB.data());
+
+				for (std::size_t ic = 0; ic < m; ic += MC) {
+					const std::size_t mc = std::min(MC, m - ic);
+
+					PackA<MR>(transposeA, mc, kc, transposeA ? a + pc * lda + ic : a + ic * lda + pc, lda, packedA.data());
+
+					for (std::size_t jr = 0; jr < nc; jr += NR) {
+						const std::size_t nr = std::min(NR, nc - jr);
+
+						for (std::size_t ir = 0; ir < mc; ir += MR) {
+							const std::size_t mr = std::min(MR, mc - ir);
+
+							MicroKernel<MR, NR>(kc, alpha, packedA.data() + ir * kc, packedB.data() + jr * kc,
+								c + (ic + ir) * ldc + jc + jr, ldc, mr, nr);
+						}
+					}
+				}
+			}
+		}
+	}
+	template<typename T, typename PointerA>
+	void BlockedGemmKernel(const GemmParameters& parameters, bool transposeA, bool transposeB,
+		std::size_t m, std::size_t n, std::size_t k, T alpha, PointerA a, std::size_t lda, const T* b, std::size_t ldb,
+		T* c, std::size_t ldc) {
+		const std::size_t microTileIndex = FindMicroTileIndex(parameters.MR, parameters.NR);
+
+		[&]<std::size_t... I>(std::index_sequence<I...>) {
+			((microTileIndex == I && (TiledGemmKernel<GemmMicroTileSizes[I].first, GemmMicroTileSizes[I].second>(parameters,
+				transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, c, ldc), true)) || ...);
+		}(std::make_index_sequence<GemmMicroTileSizes.size()>{});
+	}
+	template<typename T, typename PointerA>
+	void SerialGemmKernel(const GemmParameters& parameters, bool isSmallGemm, bool transposeA, bool transposeB,
+		std::size_t m, std::size_t n, std::size_t k, T alpha, PointerA a, std::size_t lda, const T* b, std::size_t ldb,
+		T beta, T* c, std::size_t ldc) {
+		ScaleMatrix(m, n, beta, c, ldc);
+
+		if (k == 0 || alpha == T(0)) return;
+
+		if (isSmallGemm) {
+			SmallGemmKernel(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+
+			return;
+		}
+
+		BlockedGemmKernel(parameters, transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+	}
+
+	template<typename T>
+	void ReferenceGemm(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		T alpha, const T* a, std::size_t lda, const T* b, std::size_t ldb,
+		T beta, T* c, std::size_t ldc) noexcept {
+		for (std::size_t i = 0; i < m; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				T sum = T(0);
+
+				for (std::size_t p = 0; p < k; ++p) {
+					const T aip = transposeA ? a[p * lda + i] : a[i * lda + p];
+					const T bpj = transposeB ? b[j * ldb + p] : b[p * ldb + j];
+
+					sum += aip * bpj;
+				}
+
+				c[i * ldc + j] = alpha * sum + (beta == T(0) ? T(0) : beta * c[i * ldc + j]);
+			}
+		}
+	}
+
+	const float* GatherVector(std::size_t n, const float* x, std::size_t incx, std::vector<float>& buffer) {
+		if (incx == 1) return x;
+
+		buffer.resize(n);
+
+		for (std::size_t i = 0; i < n; ++i) {
+			buffer[i] = x[i * incx];
+		}
+
+		return buffer.data();
+	}
+
+	std::pair<std::size_t, std::size_t> PartitionGemm(const GemmParameters& parameters,
+		std::size_t m, std::size_t n, std::size_t threadCount) noexcept {
+		std::pair<std::size_t, std::size_t> result(1, 1);
+		std::size_t bestArea = m * n, bestPerimeter = m + n;
+
+		for (std::size_t rowBlockCount = 1; rowBlockCount <= threadCount; ++rowBlockCount) {
+			const std::size_t columnBlockCount = threadCount / rowBlockCount;
+			const std::size_t rowBlockSize = (m + rowBlockCount - 1) / rowBlockCount;
+			const std::size_t columnBlockSize = (n + columnBlockCount - 1) / columnBlockCount;
+
+			if (rowBlockSize < parameters.MR || columnBlockSize < parameters.NR) continue;
+
+			const std::size_t area = rowBlockSize * columnBlockSize;
+			const std::size_t perimeter = rowBlockSize + columnBlockSize;
+
+			if (area < bestArea || (area == bestArea && perimeter < bestPerimeter)) {
+				result = { rowBlockCount, columnBlockCount };
+				bestArea = area;
+				bestPerimeter = perimeter;
+			}
+		}
+
+		return result;
+	}
+
+	template<typename T, typename PointerA>
+	void ParallelGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+		T alpha, PointerA a, std::size_t lda, const T* b, std::size_t ldb,
+		T beta, T* c, std::size_t ldc) {
+		if (m == 0 || n == 0) return;
+
+		ThreadPool& threadPool = GetDefaultThreadPool();
+		const std::size_t threadCount = threadPool.GetThreadCount();
+		const GemmParameters parameters = GetGemmParameters();
+		const bool isSmallGemm = m * n * k <= SmallGemmThreshold;
+
+		if (threadCount == 1 || m * n * k < parameters.ParallelThreshold) {
+			SerialGemmKernel(parameters, isSmallGemm, transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+
+			return;
+		}
+
+		const auto [rowBlockCount, columnBlockCount] = PartitionGemm(parameters, m, n, threadCount);
+		const std::size_t rowBlockSize = RoundUp((m + rowBlockCount - 1) / rowBlockCount, parameters.MR);
+		const std::size_t columnBlockSize = RoundUp((n + columnBlockCount - 1) / columnBlockCount, parameters.NR);
+
+		threadPool.Run(rowBlockCount * columnBlockCount, [&](std::size_t blockIndex) {
+			const std::size_t i = blockIndex / columnBlockCount * rowBlockSize;
+			const std::size_t j = blockIndex % columnBlockCount * columnBlockSize;
+
+			if (i >= m || j >= n) return;
+
+			SerialGemmKernel(parameters, isSmallGemm, transposeA, transposeB,
+				std::min(rowBlockSize, m - i), std::min(columnBlockSize, n - j), k,
+				alpha, transposeA ? a + i : a + i * lda, lda, transposeB ? b + j * ldb : b + j, ldb,
+				beta, c + i * ldc + j, ldc);
+		});
+	}
+}
+
+void GemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc) {
+	ParallelGemmKernel(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+void SingleThreadedGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc) {
+	SerialGemmKernel(GetGemmParameters(), m * n * k <= SmallGemmThreshold, transposeA, transposeB,
+		m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+void GemvKernel(bool transposeA, std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+	const float* x, std::size_t incx, float beta, float* y, std::size_t incy) {
+	thread_local std::vector<float> packed;
+
+	if (!transposeA) {
+		const float* const xContiguous = GatherVector(n, x, incx, packed);
+
+		for (std::size_t i = 0; i < m; ++i) {
+			float& yi = y[i * incy];
+
+			yi = alpha * DotKernel(n, a + i * lda, xContiguous) + (beta == 0.f ? 0.f : beta * yi);
+		}
+
+		return;
+	}
+
+	float* yContiguous = y;
+
+	if (incy != 1) {
+		packed.resize(n);
+		yContiguous = packed.data();
+
+		for (std::size_t j = 0; j < n; ++j) {
+			yContiguous[j] = y[j * incy];
+		}
+	}
+
+	ScaleMatrix(1, n, beta, yContiguous, n);
+
+	for (std::size_t i = 0; i < m; ++i) {
+		AxpyKernel(n, alpha * x[i * incx], a + i * lda, yContiguous);
+	}
+
+	if (incy != 1) {
+		for (std::size_t j = 0; j < n; ++j) {
+			y[j * incy] = yContiguous[j];
+		}
+	}
+}
+void GerKernel(std::size_t m, std::size_t n, float alpha, const float* x, std::size_t incx,
+	const float* y, std::size_t incy, float* a, std::size_t lda) {
+	thread_local std::vector<float> packed;
+
+	const float* const yContiguous = GatherVector(n, y, incy, packed);
+
+	for (std::size_t i = 0; i < m; ++i) {
+		AxpyKernel(n, alpha * x[i * incx], yContiguous, a + i * lda);
+	}
+}
+void CompactGemmKernel(MatrixPrecision precisionA, bool transposeA, bool transposeB,
+	std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const std::uint16_t* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc) {
+	switch (precisionA) {
+	case MatrixPrecision::BFloat16:
+		ParallelGemmKernel(transposeA, transposeB, m, n, k, alpha, CompactPointer<BFloat16ToFloat>(a), lda,
+			b, ldb, beta, c, ldc);
+		break;
+
+	case MatrixPrecision::Float16:
+		ParallelGemmKernel(transposeA, transposeB, m, n, k, alpha, CompactPointer<Float16ToFloat>(a), lda,
+			b, ldb, beta, c, ldc);
+		break;
+
+	default:
+		assert(false);
+		break;
+	}
+}
+void SparseRhsGemmKernel(std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+	const std::size_t* bOffsets, const std::size_t* bIndices, const float* bValues,
+	float beta, float* c, std::size_t ldc) noexcept {
+	ScaleMatrix(m, n, beta, c, ldc);
+
+	for (std::size_t i = 0; i < m; ++i) {
+		const float* const aRow = a + i * lda;
+		float* const cRow = c + i * ldc;
+
+		for (std::size_t j = 0; j < n; ++j) {
+			float sum = 0.f;
+
+			for (std::size_t p = bOffsets[j]; p < bOffsets[j + 1]; ++p) {
+				sum += aRow[bIndices[p]] * bValues[p];
+			}
+
+			cRow[j] += alpha * sum;
+		}
+	}
+}
+void SparseLhsGemmKernel(std::size_t m, std::size_t n, float alpha,
+	const std::size_t* aOffsets, const std::size_t* aIndices, const float* aValues,
+	const float* b, std::size_t ldb, float beta, float* c, std::size_t ldc) noexcept {
+	ScaleMatrix(m, n, beta, c, ldc);
+
+	for (std::size_t i = 0; i < m; ++i) {
+		for (std::size_t p = aOffsets[i]; p < aOffsets[i + 1]; ++p) {
+			AxpyKernel(n, alpha * aValues[p], b + aIndices[p] * ldb, c + i * ldc);
+		}
+	}
+}
+void SparseRhsTransposedGemmKernel(std::size_t m, std::size_t n, std::size_t k, float alpha,
+	const float* a, std::size_t lda, const std::size_t* bOffsets, const std::size_t* bIndices, const float* bValues,
+	float beta, float* c, std::size_t ldc) noexcept {
+	ScaleMatrix(m, n, beta, c, ldc);
+
+	for (std::size_t j = 0; j < k; ++j) {
+		for (std::size_t p = bOffsets[j]; p < bOffsets[j + 1]; ++p) {
+			const float scale = alpha * bValues[p];
+			float* const cColumn = c + bIndices[p];
+
+			for (std::size_t i = 0; i < m; ++i) {
+				cColumn[i * ldc] += scale * a[i * lda + j];
+			}
+		}
+	}
+}
+
+void QuantizedGemmKernel(std::size_t m, std::size_t n, std::size_t k,
+	const std::int8_t* a, std::size_t lda, const float* aScales,
+	const std::int8_t* b, std::size_t ldb, const float* bScales,
+	const float* bias, std::size_t biasStride, float* c, std::size_t ldc,
+	const std::function<void(std::size_t, std::size_t)>& epilogue) {
+	const std::size_t blockCount = (m + QuantizedMC - 1) / QuantizedMC;
+	const auto computeBlock = [&](std::size_t blockIndex) {
+		const std::size_t ic = blockIndex * QuantizedMC;
+		const std::size_t mc = std::min(QuantizedMC, m - ic);
+
+		for (std::size_t j = 0; j < n; ++j) {
+			const std::int8_t* const bRow = b + j * ldb;
+
+			for (std::size_t i = ic; i < ic + mc; ++i) {
+				const std::int32_t sum = DotInt8Kernel(k, a + i * lda, bRow);
+
+				c[i * ldc + j] = aScales[i] * bScales[j] * static_cast<float>(sum) + bias[i * biasStride];
+			}
+		}
+
+		epilogue(ic, mc);
+	};
+
+	if (blockCount > 1 && m * n * k >= GetParallelGemmThreshold()) {
+		GetDefaultThreadPool().Run(blockCount, computeBlock);
+	} else {
+		for (std::size_t i = 0; i < blockCount; ++i) {
+			computeBlock(i);
+		}
+	}
+}
+
+std::size_t GetGemmThreadCount() {
+	return GetDefaultThreadPool().GetThreadCount();
+}
+void SetGemmThreadCount(std::size_t newGemmThreadCount) {
+	assert(newGemmThreadCount > 0);
+
+	GetDefaultThreadPool().SetThreadCount(newGemmThreadCount);
+}
+bool IsSupportedGemmParameters(const GemmParameters& gemmParameters) noexcept {
+	return FindMicroTileIndex(gemmParameters.MR, gemmParameters.NR) < GemmMicroTileSizes.size() &&
+		gemmParameters.MC > 0 && gemmParameters.MC % gemmParameters.MR == 0 &&
+		gemmParameters.KC > 0 &&
+		gemmParameters.NC > 0 && gemmParameters.NC % gemmParameters.NR == 0;
+}
+std::vector<std::pair<std::size_t, std::size_t>> GetGemmMicroTileSizes() {
+	return { GemmMicroTileSizes.begin(), GemmMicroTileSizes.end() };
+}
+GemmParameters GetDefaultGemmParameters() noexcept {
+	return { 4, 16, 128, 256, 2048, 128 * 128 * 128 };
+}
+GemmParameters GetGemmParameters() noexcept {
+	const auto [mr, nr] = GemmMicroTileSizes[g_MicroTileIndex.load(std::memory_order_relaxed)];
+
+	return { mr, nr, g_MC.load(std::memory_order_relaxed), g_KC.load(std::memory_order_relaxed),
+		g_NC.load(std::memory_order_relaxed), g_ParallelGemmThreshold.load(std::memory_order_relaxed) };
+}
+void SetGemmParameters(const GemmParameters& newGemmParameters) noexcept {
+	assert(IsSupportedGemmParameters(newGemmParameters));
+
+	g_MicroTileIndex.store(FindMicroTileIndex(newGemmParameters.MR, newGemmParameters.NR), std::memory_order_relaxed);
+	g_MC.store(newGemmParameters.MC, std::memory_order_relaxed);
+	g_KC.store(newGemmParameters.KC, std::memory_order_relaxed);
+	g_NC.store(newGemmParameters.NC, std::memory_order_relaxed);
+	g_ParallelGemmThreshold.store(newGemmParameters.ParallelThreshold, std::memory_order_relaxed);
+}
+std::size_t GetParallelGemmThreshold() noexcept {
+	return g_ParallelGemmThreshold.load(std::memory_order_relaxed);
+}
+void SetParallelGemmThreshold(std::size_t newParallelGemmThreshold) noexcept {
+	g_ParallelGemmThreshold.store(newParallelGemmThreshold, std::memory_order_relaxed);
+}
+
+void ReferenceGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc) noexcept {
+	ReferenceGemm(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void GemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	double alpha, const double* a, std::size_t lda, const double* b, std::size_t ldb,
+	double beta, double* c, std::size_t ldc) {
+	ParallelGemmKernel(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+void ReferenceGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	double alpha, const double* a, std::size_t lda, const double* b, std::size_t ldb,
+	double beta, double* c, std::size_t ldc) noexcept {
+	ReferenceGemm(transposeA, transposeB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "HalfFloat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+struct GemmParameters final {
+	std::size_t MR, NR;
+	std::size_t MC, KC, NC;
+	std::size_t ParallelThreshold;
+};
+
+void GemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc);
+void SingleThreadedGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc);
+void GemvKernel(bool transposeA, std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+	const float* x, std::size_t incx, float beta, float* y, std::size_t incy);
+void GerKernel(std::size_t m, std::size_t n, float alpha, const float* x, std::size_t incx,
+	const float* y, std::size_t incy, float* a, std::size_t lda);
+void CompactGemmKernel(MatrixPrecision precisionA, bool transposeA, bool transposeB,
+	std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const std::uint16_t* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc);
+void SparseRhsGemmKernel(std::size_t m, std::size_t n, float alpha, const float* a, std::size_t lda,
+	const std::size_t* bOffsets, const std::size_t* bIndices, const float* bValues,
+	float beta, float* c, std::size_t ldc) noexcept;
+void SparseLhsGemmKernel(std::size_t m, std::size_t n, float alpha,
+	const std::size_t* aOffsets, const std::size_t* aIndices, const float* aValues,
+	const float* b, std::size_t ldb, float beta, float* c, std::size_t ldc) noexcept;
+void SparseRhsTransposedGemmKernel(std::size_t m, std::size_t n, std::size_t k, float alpha,
+	const float* a, std::size_t lda, const std::size_t* bOffsets, const std::size_t* bIndices, const float* bValues,
+	float beta, float* c, std::size_t ldc) noexcept;
+void QuantizedGemmKernel(std::size_t m, std::size_t n, std::size_t k,
+	const std::int8_t* a, std::size_t lda, const float* aScales,
+	const std::int8_t* b, std::size_t ldb, const float* bScales,
+	const float* bias, std::size_t biasStride, float* c, std::size_t ldc,
+	const std::function<void(std::size_t, std::size_t)>& epilogue);
+
+std::size_t GetGemmThreadCount();
+void SetGemmThreadCount(std::size_t newGemmThreadCount);
+bool IsSupportedGemmParameters(const GemmParameters& gemmParameters) noexcept;
+std::vector<std::pair<std::size_t, std::size_t>> GetGemmMicroTileSizes();
+GemmParameters GetDefaultGemmParameters() noexcept;
+GemmParameters GetGemmParameters() noexcept;
+void SetGemmParameters(const GemmParameters& newGemmParameters) noexcept;
+std::size_t GetParallelGemmThreshold() noexcept;
+void SetParallelGemmThreshold(std::size_t newParallelGemmThreshold) noexcept;
+
+void ReferenceGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	float alpha, const float* a, std::size_t lda, const float* b, std::size_t ldb,
+	float beta, float* c, std::size_t ldc) noexcept;
+
+void GemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	double alpha, const double* a, std::size_t lda, const double* b, std::size_t ldb,
+	double beta, double* c, std::size_t ldc);
+void ReferenceGemmKernel(bool transposeA, bool transposeB, std::size_t m, std::size_t n, std::size_t k,
+	double alpha, const double* a, std::size_t lda, const double* b, std::size_t ldb,
+	double beta, double* c, std::size_t ldc) noexcept;
\ No newline at end of file
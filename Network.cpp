@@ -1,9 +1,13 @@
 #include "Network.hpp"
 
+#include "ComputeBackend.hpp"
 #include "Optimizer.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <ranges>
+#include <stdexcept>
 
 const Layer& Network::GetLayer(std::size_t index) const noexcept {
 	return *m_Layers[index].get();
@@ -17,32 +21,78 @@ std::size_t Network::GetLayerCount() const noexcept {
 void Network::AddLayer(std::unique_ptr<Layer>&& newLayer) {
 	assert(newLayer != nullptr);
 
+	Dequantize();
+	newLayer->SetPrecision(m_Precision);
 	m_Layers.push_back(std::move(newLayer));
+	AssignParameterArena();
 }
 void Network::RemoveLayer(std::size_t index) noexcept {
 	assert(index < m_Layers.size());
 
+	Dequantize();
 	m_Layers.erase(m_Layers.begin() + index);
 }
+std::vector<Parameter> Network::GetAllParameters() {
+	std::vector<Parameter> result;
 
-Matrix Network::Forward(const Matrix& input) {
+	for (auto& layer : m_Layers) {
+		for (auto& parameter : layer->GetParameterTable().GetAllParameters()) {
+			result.push_back(parameter);
+		}
+	}
+
+	return result;
+}
+ParameterArena& Network::GetParameterArena() {
+	AssignParameterArena();
+
+	return *m_ParameterArena;
+}
+
+const Matrix& Network::Forward(const Matrix& input) {
 	assert(!m_Layers.empty());
 
-	Matrix nextInput = input;
+	const ComputeBackendScope backendScope(m_ComputeBackend.get());
 
-	for (auto& layer : m_Layers) {
-		nextInput = layer->Forward(nextInput);
+	return ForwardFrom(0, input);
+}
+const Matrix& Network::Forward(const SparseMatrix& input) {
+	assert(!m_Layers.empty());
+
+	const ComputeBackendScope backendScope(m_ComputeBackend.get());
+
+	return ForwardFrom(1, m_Layers.front()->Forward(input));
+}
+const Matrix& Network::Forward(const TrainInput& input) {
+	return std::visit([this](const auto& matrix) -> const Matrix& {
+		return Forward(matrix);
+	}, input);
+}
+const Matrix& Network::ForwardFrom(std::size_t firstLayerIndex, const Matrix& input) {
+	const Matrix* nextInput = &input;
+
+	for (std::size_t i = firstLayerIndex; i < m_Layers.size(); ++i) {
+		if (!m_IsFusedLayer.empty() && m_IsFusedLayer[i]) continue;
+
+		nextInput = &m_Layers[i]->Forward(*nextInput);
 	}
 
-	return nextInput;
+	return *nextInput;
 }
 void Network::Backward(const Matrix& input) {
 	assert(!m_Layers.empty());
 
-	Matrix nextInput = input;
+	Backward(input, m_Layers.size() - 1);
+}
+void Network::Backward(const Matrix& input, std::size_t lastLayerIndex) {
+	assert(lastLayerIndex < m_Layers.size());
+
+	const ComputeBackendScope backendScope(m_ComputeBackend.get());
+	const Matrix* nextInput = &input;
 
-	for (auto& layer : std::ranges::views::reverse(m_Layers)) {
-		nextInput = layer->Backward(nextInput);
+	for (auto& layer : std::ranges::views::reverse(
+		std::ranges::views::counted(m_Layers.begin(), lastLayerIndex + 1))) {
+		nextInput = &layer->Backward(*nextInput);
 	}
 }
 std::size_t Network::GetInputSize() const noexcept {
@@ -88,6 +138,112 @@ std::size_t Network::GetOutputSize(std::size_t layerIndex) const noexcept {
 	return 0;
 }
 
+MatrixPrecision Network::GetPrecision() const noexcept {
+	return m_Precision;
+}
+void Network::SetPrecision(MatrixPrecision newPrecision) {
+	Dequantize();
+
+	for (auto& layer : m_Layers) {
+		layer->SetPrecision(newPrecision);
+	}
+
+	m_Precision = newPrecision;
+	AssignParameterArena();
+}
+void Network::Quantize(const TrainData& calibrationData) {
+	assert(!m_Layers.empty());
+	assert(!calibrationData.empty());
+	assert(m_Precision == MatrixPrecision::Float32);
+
+	Dequantize();
+
+	std::vector<std::vector<float>> inputMaxMagnitudes(m_Layers.size());
+
+	for (std::size_t i = 0; i < m_Layers.size(); ++i) {
+		if (m_Layers[i]->GetName() != "FCLayer") continue;
+
+		inputMaxMagnitudes[i].assign(m_Layers[i]->GetForwardInputSize(), 0.f);
+	}
+
+	for (const auto& [input, target] : calibrationData) {
+		Forward(input);
+
+		for (std::size_t i = 0; i < m_Layers.size(); ++i) {
+			if (m_Layers[i]->GetName() != "FCLayer") continue;
+
+			std::vector<float>& maxMagnitudes = inputMaxMagnitudes[i];
+
+			if (const SparseMatrix* const sparseInput = m_Layers[i]->GetLastSparseForwardInput(); sparseInput) {
+				const std::size_t* const offsets = sparseInput->GetOffsets();
+				const std::size_t* const indices = sparseInput->GetIndices();
+				const float* const values = sparseInput->GetValues();
+
+				if (sparseInput->GetFormat() == SparseMatrixFormat::CSC) {
+					for (std::size_t j = 0; j < sparseInput->GetNonZeroCount(); ++j) {
+						maxMagnitudes[indices[j]] = std::max(maxMagnitudes[indices[j]], std::abs(values[j]));
+					}
+				} else {
+					for (std::size_t r = 0; r < sparseInput->GetRowSize(); ++r) {
+						for (std::size_t j = offsets[r]; j < offsets[r + 1]; ++j) {
+							maxMagnitudes[r] = std::max(maxMagnitudes[r], std::abs(values[j]));
+						}
+					}
+				}
+
+				continue;
+			}
+
+			const Matrix& layerInput = m_Layers[i]->GetLastForwardInput();
+
+			for (std::size_t r = 0; r < layerInput.GetRowSize(); ++r) {
+				for (std::size_t c = 0; c < layerInput.GetColumnSize(); ++c) {
+					maxMagnitudes[r] = std::max(maxMagnitudes[r], std::abs(layerInput(r, c)));
+				}
+			}
+		}
+	}
+
+	m_IsFusedLayer.assign(m_Layers.size(), false);
+
+	for (std::size_t i = 0; i < m_Layers.size(); ++i) {
+		if (m_Layers[i]->GetName() != "FCLayer") continue;
+
+		const ALayer* fusedALayer = nullptr;
+
+		if (i + 1 < m_Layers.size() && m_Layers[i + 1]->GetName() == "ALayer") {
+			fusedALayer = static_cast<const ALayer*>(m_Layers[i + 1].get());
+			m_IsFusedLayer[i + 1] = true;
+		}
+
+		std::vector<float> inputScales = std::move(inputMaxMagnitudes[i]);
+
+		for (float& inputScale : inputScales) {
+			inputScale = inputScale > 0.f ? inputScale / 127.f : 1.f;
+		}
+
+		static_cast<FCLayer&>(*m_Layers[i]).Quantize(std::move(inputScales), fusedALayer);
+	}
+}
+void Network::Dequantize() noexcept {
+	for (auto& layer : m_Layers) {
+		if (layer->GetName() == "FCLayer") {
+			static_cast<FCLayer&>(*layer).Dequantize();
+		}
+	}
+
+	m_IsFusedLayer.clear();
+}
+bool Network::IsQuantized() const noexcept {
+	return !m_IsFusedLayer.empty();
+}
+std::shared_ptr<const ComputeBackend> Network::GetComputeBackend() const noexcept {
+	return m_ComputeBackend;
+}
+void Network::SetComputeBackend(const std::shared_ptr<const ComputeBackend>& computeBackend) noexcept {
+	m_ComputeBackend = computeBackend;
+}
+
 NetworkDump Network::GetDump() const {
 	std::vector<LayerDump> layers;
 
@@ -118,8 +274,23 @@ void Network::Optimize(const TrainData& trainData, std::size_t epoch) {
 	assert(!m_Layers.empty());
 	assert(m_Optimizer != nullptr);
 
+	if (m_Precision != MatrixPrecision::Float32) throw std::runtime_error("Training requires fp32 precision");
+
+	Dequantize();
+
+	const ComputeBackendScope backendScope(m_ComputeBackend.get());
+
 	m_Optimizer->Optimize(trainData, epoch);
 }
+void Network::AssignParameterArena() {
+	std::vector<ParameterTable*> parameterTables;
+
+	for (auto& layer : m_Layers) {
+		parameterTables.push_back(&layer->GetParameterTable());
+	}
+
+	m_ParameterArena = ParameterArena::Assign(parameterTables);
+}
 
 NetworkDump::NetworkDump(std::vector<LayerDump>&& layers) noexcept
 	: m_Layers(std::move(layers)) {}
@@ -6,19 +6,26 @@
 #include <cstddef>
 #include <memory>
 #include <utility>
+#include <variant>
 #include <vector>
 
+class ComputeBackend;
 class Optimizer;
 
-using TrainSample = std::pair<Matrix, Matrix>;
+using TrainInput = std::variant<Matrix, SparseMatrix>;
+using TrainSample = std::pair<TrainInput, Matrix>;
 using TrainData = std::vector<TrainSample>;
 
 class NetworkDump;
 
 class Network final {
 private:
+	std::shared_ptr<ParameterArena> m_ParameterArena;
 	std::vector<std::unique_ptr<Layer>> m_Layers;
 	std::unique_ptr<Optimizer> m_Optimizer;
+	MatrixPrecision m_Precision = MatrixPrecision::Float32;
+	std::vector<bool> m_IsFusedLayer;
+	std::shared_ptr<const ComputeBackend> m_ComputeBackend;
 
 public:
 	Network() noexcept = default;
@@ -34,12 +41,24 @@ public:
 	std::size_t GetLayerCount() const noexcept;
 	void AddLayer(std::unique_ptr<Layer>&& newLayer);
 	void RemoveLayer(std::size_t index) noexcept;
+	std::vector<Parameter> GetAllParameters();
+	ParameterArena& GetParameterArena();
 
-	Matrix Forward(const Matrix& input);
+	const Matrix& Forward(const Matrix& input);
+	const Matrix& Forward(const SparseMatrix& input);
+	const Matrix& Forward(const TrainInput& input);
 	void Backward(const Matrix& input);
+	void Backward(const Matrix& input, std::size_t lastLayerIndex);
 	std::size_t GetInputSize() const noexcept;
 	std::size_t GetOutputSize() const noexcept;
 	std::size_t GetOutputSize(std::size_t layerIndex) const noexcept;
+	MatrixPrecision GetPrecision() const noexcept;
+	void SetPrecision(MatrixPrecision newPrecision);
+	void Quantize(const TrainData& calibrationData);
+	void Dequantize() noexcept;
+	bool IsQuantized() const noexcept;
+	std::shared_ptr<const ComputeBackend> GetComputeBackend() const noexcept;
+	void SetComputeBackend(const std::shared_ptr<const ComputeBackend>& computeBackend) noexcept;
 
 	NetworkDump GetDump() const;
 
@@ -48,6 +67,10 @@ public:
 	Optimizer& GetOptimizer() noexcept;
 	void SetOptimizer(std::unique_ptr<Optimizer>&& optimizer) noexcept;
 	void Optimize(const TrainData& trainData, std::size_t epoch);
+
+private:
+	const Matrix& ForwardFrom(std::size_t firstLayerIndex, const Matrix& input);
+	void AssignParameterArena();
 };
 
 class NetworkDump final {
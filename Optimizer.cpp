@@ -1,13 +1,16 @@
 #include "Optimizer.hpp"
 
+#include "ComputeBackend.hpp"
 #include "Layer.hpp"
+#include "Random.hpp"
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <random>
+#include <limits>
 #include <numeric>
 #include <utility>
+#include <variant>
 #include <vector>
 
 LossFunction::LossFunction(std::string name) noexcept
@@ -17,6 +20,14 @@ std::string_view LossFunction::GetName() const noexcept {
 	return m_Name;
 }
 
+Matrix LossFunction::Backward(const Matrix& input, const Matrix& target) const {
+	Matrix result;
+
+	Backward(input, target, result);
+
+	return result;
+}
+
 class MSEImpl final : public LossFunction {
 public:
 	MSEImpl()
@@ -29,20 +40,19 @@ public:
 
 public:
 	virtual float Forward(const Matrix& input, const Matrix& target) const override {
-		const auto [row, column] = input.GetSize();
-		const Matrix error = input - target;
+		const ComputeBackend& backend = GetComputeBackend();
 		float result = 0;
 
-		for (std::size_t i = 0; i < column; ++i) {
-			for (std::size_t j = 0; j < row; ++j) {
-				result += std::powf(error(j, i), 2);
-			}
-		}
+		VisitRows(input, target, [&backend, &result](std::size_t n, const float* x, const float* y) noexcept {
+			result += backend.SquaredDistance(n, x, y);
+		});
 
-		return result / column;
+		return result / input.GetColumnSize();
 	}
-	virtual Matrix Backward(const Matrix& input, const Matrix& target) const override {
-		return (2.f / input.GetColumnSize()) * (input - target);
+	using LossFunction::Backward;
+
+	virtual void Backward(const Matrix& input, const Matrix& target, Matrix& result) const override {
+		result = (2.f / input.GetColumnSize()) * (input - target);
 	}
 };
 
@@ -63,29 +73,142 @@ public:
 
 		for (std::size_t i = 0; i < column; ++i) {
 			for (std::size_t j = 0; j < row; ++j) {
-				result += target(j, i) * std::logf(input(j, i));
+				result += target(j, i) * std::logf(std::max(input(j, i), std::numeric_limits<float>::min()));
 			}
 		}
 
 		return result / column;
 	}
-	virtual Matrix Backward(const Matrix& input, const Matrix& target) const override {
-		const auto [row, column] = input.GetSize();
-		Matrix result(row, column);
+	using LossFunction::Backward;
 
-		for (std::size_t i = 0; i < column; ++i) {
-			for (std::size_t j = 0; j < row; ++j) {
-				result(j, i) = target(j, i) / input(j, i);
-			}
-		}
+	virtual void Backward(const Matrix& input, const Matrix& target, Matrix& result) const override {
+		const ComputeBackend& backend = GetComputeBackend();
 
-		return (-1.f / column) * result;
+		result = target;
+
+		TransformRows(result, input, [&backend](std::size_t n, const float* x, float* y) noexcept {
+			backend.Divide(n, x, y);
+		});
+		result *= -1.f / input.GetColumnSize();
 	}
 };
 
 const std::shared_ptr<const LossFunction> MSE = std::make_shared<MSEImpl>();
 const std::shared_ptr<const LossFunction> CE = std::make_shared<CEImpl>();
 
+namespace {
+	void GatherSparseSamples(const TrainData& trainData, const std::size_t* sampleIndices, std::size_t count,
+		std::size_t inputSize, SparseMatrix& input) {
+		std::vector<std::size_t> offsets(1, 0), indices;
+		std::vector<float> values;
+
+		offsets.reserve(count + 1);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			const SparseMatrix& sampleInput = std::get<SparseMatrix>(trainData[sampleIndices[i]].first);
+			const std::size_t* const sampleOffsets = sampleInput.GetOffsets();
+			const std::size_t* const sampleRowIndices = sampleInput.GetIndices();
+			const float* const sampleValues = sampleInput.GetValues();
+
+			assert(sampleInput.GetSize() == std::make_pair(inputSize, std::size_t(1)));
+
+			if (sampleInput.GetFormat() == SparseMatrixFormat::CSC) {
+				indices.insert(indices.end(), sampleRowIndices, sampleRowIndices + sampleOffsets[1]);
+				values.insert(values.end(), sampleValues, sampleValues + sampleOffsets[1]);
+			} else {
+				for (std::size_t j = 0; j < inputSize; ++j) {
+					for (std::size_t k = sampleOffsets[j]; k < sampleOffsets[j + 1]; ++k) {
+						indices.push_back(j);
+						values.push_back(sampleValues[k]);
+					}
+				}
+			}
+
+			offsets.push_back(indices.size());
+		}
+
+		input = SparseMatrix(inputSize, count, SparseMatrixFormat::CSC,
+			std::move(offsets), std::move(indices), std::move(values));
+	}
+	void GatherSamples(const TrainData& trainData, const std::size_t* sampleIndices, std::size_t count,
+		TrainInput& input, Matrix& target) {
+		const TrainSample& firstSample = trainData[sampleIndices[0]];
+		const std::size_t inputSize = std::visit([](const auto& sampleInput) noexcept {
+			return sampleInput.GetRowSize();
+		}, firstSample.first);
+		const std::size_t targetSize = firstSample.second.GetRowSize();
+		const bool isSparse = std::all_of(sampleIndices, sampleIndices + count, [&trainData](std::size_t index) noexcept {
+			return std::holds_alternative<SparseMatrix>(trainData[index].first);
+		});
+
+		// 희소 표본만으로 이루어진 배치는 CSC 배치로 이어 붙여 희소 커널을 그대로 사용함
+		if (isSparse) {
+			if (!std::holds_alternative<SparseMatrix>(input)) {
+				input.emplace<SparseMatrix>();
+			}
+
+			GatherSparseSamples(trainData, sampleIndices, count, inputSize, std::get<SparseMatrix>(input));
+		} else {
+			if (!std::holds_alternative<Matrix>(input)) {
+				input.emplace<Matrix>();
+			}
+
+			Matrix& denseInput = std::get<Matrix>(input);
+
+			denseInput.Resize(inputSize, count);
+
+			for (std::size_t i = 0; i < count; ++i) {
+				const TrainInput& sampleInput = trainData[sampleIndices[i]].first;
+
+				if (const auto denseSampleInput = std::get_if<Matrix>(&sampleInput); denseSampleInput) {
+					assert(denseSampleInput->GetSize() == std::make_pair(inputSize, std::size_t(1)));
+
+					for (std::size_t j = 0; j < inputSize; ++j) {
+						denseInput(j, i) = (*denseSampleInput)(j, 0);
+					}
+				} else {
+					std::get<SparseMatrix>(sampleInput).Expand(denseInput.Column(i));
+				}
+			}
+		}
+
+		target.Resize(targetSize, count);
+
+		for (std::size_t i = 0; i < count; ++i) {
+			const Matrix& sampleTarget = trainData[sampleIndices[i]].second;
+
+			assert(sampleTarget.GetSize() == std::make_pair(targetSize, std::size_t(1)));
+
+			for (std::size_t j = 0; j < targetSize; ++j) {
+				target(j, i) = sampleTarget(j, 0);
+			}
+		}
+	}
+
+	class FusedLearningRateScope final {
+	private:
+		std::vector<FCLayer*> m_Layers;
+
+	public:
+		FusedLearningRateScope() noexcept = default;
+		FusedLearningRateScope(const FusedLearningRateScope&) = delete;
+		~FusedLearningRateScope() {
+			for (const auto layer : m_Layers) {
+				layer->SetFusedLearningRate(0.f);
+			}
+		}
+
+	public:
+		FusedLearningRateScope& operator=(const FusedLearningRateScope&) = delete;
+
+	public:
+		void Add(FCLayer& layer, float learningRate) {
+			m_Layers.push_back(&layer);
+			layer.SetFusedLearningRate(learningRate);
+		}
+	};
+}
+
 Optimizer::Optimizer(std::string name) noexcept
 	: m_Name(std::move(name)) {}
 Optimizer::Optimizer(const Optimizer& other)
@@ -112,11 +235,20 @@ std::shared_ptr<const LossFunction> Optimizer::GetLossFunction() const noexcept
 void Optimizer::SetLossFunction(const std::shared_ptr<const LossFunction>& lossFunction) noexcept {
 	m_LossFunction = lossFunction;
 }
+float Optimizer::ComputeLoss(const Matrix& output, const Matrix& target) const {
+	// output은 대상 신경망의 마지막 순전파 결과여야 함
+	const Network& network = GetTargetNetwork();
+	const SMLayer* const softmaxLayer = m_LossFunction == CE ?
+		dynamic_cast<const SMLayer*>(&network.GetLayer(network.GetLayerCount() - 1)) : nullptr;
+
+	return softmaxLayer ? softmaxLayer->ForwardCrossEntropy(target) : m_LossFunction->Forward(output, target);
+}
 
 SGDOptimizer::SGDOptimizer()
 	: Optimizer("SGDOptimizer") {}
 SGDOptimizer::SGDOptimizer(const SGDOptimizer& other)
-	: Optimizer(other), m_LearningRate(other.m_LearningRate) {}
+	: Optimizer(other), m_LearningRate(other.m_LearningRate), m_BatchSize(other.m_BatchSize),
+	m_AccumulationStepCount(other.m_AccumulationStepCount) {}
 
 float SGDOptimizer::GetLearningRate() const noexcept {
 	return m_LearningRate;
@@ -127,6 +259,22 @@ void SGDOptimizer::SetLearningRate(float newLearningRate) noexcept {
 
 	m_LearningRate = newLearningRate;
 }
+std::size_t SGDOptimizer::GetBatchSize() const noexcept {
+	return m_BatchSize;
+}
+void SGDOptimizer::SetBatchSize(std::size_t newBatchSize) noexcept {
+	assert(newBatchSize > 0);
+
+	m_BatchSize = newBatchSize;
+}
+std::size_t SGDOptimizer::GetAccumulationStepCount() const noexcept {
+	return m_AccumulationStepCount;
+}
+void SGDOptimizer::SetAccumulationStepCount(std::size_t newAccumulationStepCount) noexcept {
+	assert(newAccumulationStepCount > 0);
+
+	m_AccumulationStepCount = newAccumulationStepCount;
+}
 
 std::unique_ptr<Optimizer> SGDOptimizer::Copy() const {
 	return std::make_unique<SGDOptimizer>(*this);
@@ -137,30 +285,99 @@ void SGDOptimizer::Optimize(const TrainData& trainData, std::size_t epoch) {
 	assert(epoch > 0);
 
 	Network& network = GetTargetNetwork();
+	ParameterArena& parameterArena = network.GetParameterArena();
 	const std::size_t layerCount = network.GetLayerCount();
 
 	const auto lossFunction = GetLossFunction();
 	const std::size_t sampleCount = trainData.size();
+	const std::size_t batchSize = std::min(m_BatchSize, sampleCount);
+	const bool isAccumulating = m_AccumulationStepCount > 1;
 
 	std::vector<std::size_t> samples(sampleCount);
 	std::iota(samples.begin(), samples.end(), 0);
 
-	std::mt19937 mt(std::random_device{}());
+	FusedLearningRateScope fusedLayers;
+	std::vector<Parameter> unfusedParameters;
+	Matrix accumulatedGradients;
+
+	if (isAccumulating) {
+		accumulatedGradients.Resize(1, parameterArena.GetSize());
+	} else {
+		for (std::size_t i = 0; i < layerCount; ++i) {
+			Layer& layer = network.GetLayer(i);
+
+			if (const auto fcLayer = dynamic_cast<FCLayer*>(&layer)) {
+				fusedLayers.Add(*fcLayer, m_LearningRate);
+			} else {
+				const auto parameters = layer.GetParameterTable().GetAllParameters();
+
+				unfusedParameters.insert(unfusedParameters.end(), parameters.begin(), parameters.end());
+			}
+		}
+	}
+
+	SMLayer* const softmaxLayer = lossFunction == CE ?
+		dynamic_cast<SMLayer*>(&network.GetLayer(layerCount - 1)) : nullptr;
+
+	Philox4x32 engine(GetRandomSeed(), AcquireRandomStream());
+	TrainInput batchInput;
+	Matrix batchTarget;
+	Matrix gradient;
+
+	std::size_t accumulatedStepCount = 0, accumulatedSampleCount = 0;
+
+	const auto applyAccumulatedGradients = [&] {
+		Axpy(parameterArena.GetValues(), -m_LearningRate / accumulatedSampleCount, accumulatedGradients);
+		Scale(accumulatedGradients, 0.f);
+
+		accumulatedStepCount = 0;
+		accumulatedSampleCount = 0;
+	};
 
 	for (std::size_t i = 0; i < epoch; ++i) {
-		std::ranges::shuffle(samples, mt);
+		std::ranges::shuffle(samples, engine);
+
+		for (std::size_t first = 0; first < sampleCount; first += batchSize) {
+			const std::size_t count = std::min(batchSize, sampleCount - first);
+			const TrainSample& sample = trainData[samples[first]];
+
+			if (count > 1) {
+				GatherSamples(trainData, &samples[first], count, batchInput, batchTarget);
+			}
+
+			const Matrix& target = count > 1 ? batchTarget : sample.second;
+			const Matrix& output = count > 1 ? network.Forward(batchInput) : network.Forward(sample.first);
 
-		for (const auto sampleIndex : samples) {
-			const TrainSample& sample = trainData[sampleIndex];
-			const Matrix output = network.Forward(sample.first);
-			const Matrix gradient = lossFunction->Backward(output, sample.second);
-			network.Backward(gradient);
+			if (softmaxLayer) {
+				softmaxLayer->BackwardCrossEntropy(target, gradient);
 
-			for (std::size_t j = 0; j < layerCount; ++j) {
-				for (auto& parameter : network.GetLayer(layerCount - j - 1).GetParameterTable().GetAllParameters()) {
-					parameter.GetValue() -= m_LearningRate * parameter.GetGradient();
+				if (layerCount > 1) {
+					network.Backward(gradient, layerCount - 2);
 				}
+			} else {
+				lossFunction->Backward(output, target, gradient);
+				network.Backward(gradient);
 			}
+
+			if (!isAccumulating) {
+				for (const auto& parameter : unfusedParameters) {
+					Axpy(parameter.GetValue(), -m_LearningRate, parameter.GetGradient());
+				}
+
+				continue;
+			}
+
+			Axpy(accumulatedGradients, static_cast<float>(count), parameterArena.GetGradients());
+
+			accumulatedSampleCount += count;
+
+			if (++accumulatedStepCount == m_AccumulationStepCount) {
+				applyAccumulatedGradients();
+			}
+		}
+
+		if (accumulatedStepCount > 0) {
+			applyAccumulatedGradients();
 		}
 	}
 }
\ No newline at end of file
@@ -24,7 +24,8 @@ public:
 	std::string_view GetName() const noexcept;
 
 	virtual float Forward(const Matrix& input, const Matrix& target) const = 0;
-	virtual Matrix Backward(const Matrix& input, const Matrix& target) const = 0;
+	Matrix Backward(const Matrix& input, const Matrix& target) const;
+	virtual void Backward(const Matrix& input, const Matrix& target, Matrix& result) const = 0;
 };
 
 extern const std::shared_ptr<const LossFunction> MSE;
@@ -53,6 +54,7 @@ public:
 
 	std::shared_ptr<const LossFunction> GetLossFunction() const noexcept;
 	void SetLossFunction(const std::shared_ptr<const LossFunction>& lossFunction) noexcept;
+	float ComputeLoss(const Matrix& output, const Matrix& target) const;
 
 	virtual std::unique_ptr<Optimizer> Copy() const = 0;
 
@@ -62,6 +64,8 @@ public:
 class SGDOptimizer final : public Optimizer {
 private:
 	float m_LearningRate = 0.1f;
+	std::size_t m_BatchSize = 1;
+	std::size_t m_AccumulationStepCount = 1;
 
 public:
 	SGDOptimizer();
@@ -74,6 +78,10 @@ public:
 public:
 	float GetLearningRate() const noexcept;
 	void SetLearningRate(float newLearningRate) noexcept;
+	std::size_t GetBatchSize() const noexcept;
+	void SetBatchSize(std::size_t newBatchSize) noexcept;
+	std::size_t GetAccumulationStepCount() const noexcept;
+	void SetAccumulationStepCount(std::size_t newAccumulationStepCount) noexcept;
 
 public:
 	virtual std::unique_ptr<Optimizer> Copy() const override;
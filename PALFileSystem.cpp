@@ -0,0 +1,5 @@
+#include "PALFileSystem.hpp"
+
+std::filesystem::path GetUserDataDirectory() {
+	return PALGetUserDataDirectory();
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <filesystem>
+
+std::filesystem::path GetUserDataDirectory();
+
+std::filesystem::path PALGetUserDataDirectory();
\ No newline at end of file
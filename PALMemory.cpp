@@ -0,0 +1,18 @@
+#include "PALMemory.hpp"
+
+#include <cassert>
+#include <new>
+
+void* AllocateAlignedMemory(std::size_t byteCount, std::size_t alignment, bool useHugePages) {
+	assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	void* const pointer = PALAllocateAlignedMemory(byteCount, alignment, useHugePages);
+	if (pointer == nullptr) throw std::bad_alloc();
+
+	return pointer;
+}
+void DeallocateAlignedMemory(void* pointer) noexcept {
+	if (pointer == nullptr) return;
+
+	PALDeallocateAlignedMemory(pointer);
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+
+void* AllocateAlignedMemory(std::size_t byteCount, std::size_t alignment, bool useHugePages);
+void DeallocateAlignedMemory(void* pointer) noexcept;
+
+void* PALAllocateAlignedMemory(std::size_t byteCount, std::size_t alignment, bool useHugePages);
+void PALDeallocateAlignedMemory(void* pointer) noexcept;
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef _WIN32
+#include "PALFileSystem.hpp"
+
+#include "Application.hpp"
+
+#include <cstdlib>
+
+std::filesystem::path PALGetUserDataDirectory() {
+	if (const char* const cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome && *cacheHome)
+		return std::filesystem::path(cacheHome) / SAM_APPNAME;
+	if (const char* const home = std::getenv("HOME"); home && *home)
+		return std::filesystem::path(home) / ".cache" / SAM_APPNAME;
+
+	return {};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef _WIN32
+#include "PALMemory.hpp"
+
+#include <cstdlib>
+#include <sys/mman.h>
+
+void* PALAllocateAlignedMemory(std::size_t byteCount, std::size_t alignment, bool useHugePages) {
+	void* pointer = nullptr;
+	if (posix_memalign(&pointer, alignment, byteCount) != 0) return nullptr;
+
+#	ifdef MADV_HUGEPAGE
+	if (useHugePages) {
+		madvise(pointer, byteCount, MADV_HUGEPAGE);
+	}
+#	endif
+
+	return pointer;
+}
+void PALDeallocateAlignedMemory(void* pointer) noexcept {
+	std::free(pointer);
+}
+#endif
\ No newline at end of file
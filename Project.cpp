@@ -9,6 +9,7 @@
 #include <cassert>
 #include <fstream>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 
 ResourceObject::~ResourceObject() {}
@@ -153,6 +154,12 @@ void Project::SetPath(std::filesystem::path newPath) noexcept {
 
 	m_Path = std::move(newPath);
 }
+std::uint64_t Project::GetSeed() const noexcept {
+	return m_Seed;
+}
+void Project::SetSeed(std::uint64_t newSeed) noexcept {
+	m_Seed = newSeed;
+}
 
 const Network& Project::GetNetwork() const noexcept {
 	return m_Network;
@@ -168,6 +175,8 @@ ResourceDirectory& Project::GetResources() noexcept {
 }
 
 namespace {
+	constexpr std::uint32_t MaxInt32 = std::numeric_limits<std::int32_t>::max();
+
 	void ReadVariableTable(BinaryAdaptor& bin, VariableTable& variableTable) {
 		const std::uint32_t variableCount = bin.ReadInt32();
 
@@ -184,7 +193,7 @@ namespace {
 		bin.Write(static_cast<std::int32_t>(variables.size()));
 		for (const auto& variable : variables) {
 			bin.Write(std::string(variable.GetName()));
-			bin.Write(variable.GetValue());
+			bin.Write(variable.GetExpandedValue());
 		}
 	}
 
@@ -196,9 +205,8 @@ namespace {
 			Matrix parameterValue = bin.ReadMatrix();
 			Matrix parameterGradient = bin.ReadMatrix();
 
-			const Parameter parameter =
-				parameterTable.AddParameter(std::move(parameterName), std::move(parameterValue));
-			parameter.SetGradient(std::move(parameterGradient));
+			const Parameter parameter = parameterTable.AddParameter(std::move(parameterName), parameterValue);
+			parameter.SetGradient(parameterGradient);
 
 			ReadVariableTable(bin, parameter.GetVariableTable());
 		}
@@ -209,7 +217,7 @@ namespace {
 		bin.Write(static_cast<std::int32_t>(parameters.size()));
 		for (const auto& parameter : parameters) {
 			bin.Write(std::string(parameter.GetName()));
-			bin.Write(parameter.GetValue());
+			bin.Write(parameter.GetExpandedValue());
 			bin.Write(parameter.GetGradient());
 			WriteVariableTable(bin, parameter.GetVariableTable());
 		}
@@ -220,7 +228,11 @@ namespace {
 		trainSample.second = bin.ReadMatrix();
 	}
 	void WriteTrainSample(BinaryAdaptor& bin, const TrainSample& trainSample) {
-		bin.Write(trainSample.first);
+		if (const auto sparseInput = std::get_if<SparseMatrix>(&trainSample.first); sparseInput) {
+			bin.Write(sparseInput->Expand());
+		} else {
+			bin.Write(std::get<Matrix>(trainSample.first));
+		}
 		bin.Write(trainSample.second);
 	}
 	void ReadTrainData(BinaryAdaptor& bin, TrainData& trainData) {
@@ -237,7 +249,7 @@ namespace {
 		}
 	}
 
-	void ReadNetwork(BinaryAdaptor& bin, Network& network) {
+	void ReadNetwork(BinaryAdaptor& bin, Network& network, std::uint32_t version) {
 		const std::uint32_t layerCount = bin.ReadInt32();
 
 		for (std::uint32_t i = 0; i < layerCount; ++i) {
@@ -275,6 +287,17 @@ namespace {
 			auto sgdOptimizer = std::make_unique<SGDOptimizer>();
 			sgdOptimizer->SetLearningRate(learningRate);
 
+			if (version >= 0x00000002) {
+				const std::uint32_t batchSize = bin.ReadInt32();
+				const std::uint32_t accumulationStepCount = bin.ReadInt32();
+				if (batchSize == 0 || batchSize > MaxInt32 || accumulationStepCount == 0 || accumulationStepCount > MaxInt32) {
+					throw std::runtime_error("Invalid batch size or accumulation step count");
+				}
+
+				sgdOptimizer->SetBatchSize(batchSize);
+				sgdOptimizer->SetAccumulationStepCount(accumulationStepCount);
+			}
+
 			optimizer = std::move(sgdOptimizer);
 		} else throw std::runtime_error("Invalid optimizer name");
 
@@ -320,7 +343,13 @@ namespace {
 			if (optimizerName == "SGDOptimizer") {
 				const auto& sgdOptimizer = static_cast<const SGDOptimizer&>(optimizer);
 
+				if (sgdOptimizer.GetBatchSize() > MaxInt32 || sgdOptimizer.GetAccumulationStepCount() > MaxInt32) {
+					throw std::runtime_error("Too large batch size or accumulation step count");
+				}
+
 				bin.Write(sgdOptimizer.GetLearningRate());
+				bin.Write(static_cast<std::int32_t>(sgdOptimizer.GetBatchSize()));
+				bin.Write(static_cast<std::int32_t>(sgdOptimizer.GetAccumulationStepCount()));
 			}
 
 			bin.Write(std::string(optimizer.GetLossFunction()->GetName()));
@@ -425,10 +454,15 @@ void Project::Load(std::filesystem::path path) {
 
 	const std::uint32_t version = bin.ReadInt32();
 	switch (version) {
-	case 0x00000000: {
+	case 0x00000000:
+	case 0x00000001:
+	case 0x00000002: {
 		m_Name = bin.ReadString();
+		if (version >= 0x00000001) {
+			m_Seed = static_cast<std::uint64_t>(bin.ReadInt64());
+		}
 
-		ReadNetwork(bin, m_Network);
+		ReadNetwork(bin, m_Network, version);
 		ReadResourceObjects(bin, m_Resources);
 
 		break;
@@ -452,6 +486,7 @@ void Project::Save() const {
 	bin.Write(static_cast<std::int32_t>(m_Version));
 
 	bin.Write(m_Name);
+	bin.Write(static_cast<std::int64_t>(m_Seed));
 
 	WriteNetwork(bin, m_Network);
 	WriteResourceObjects(bin, m_Resources);
@@ -2,6 +2,7 @@
 
 #include "Matrix.hpp"
 #include "Network.hpp"
+#include "Random.hpp"
 
 #include <chrono>
 #include <cstdint>
@@ -105,11 +106,12 @@ public:
 class Project final {
 private:
 	static inline const std::uint8_t m_MagicNumber[] = { 'S', 'H', 'I', 'T', 'A', 'M' };
-	static inline const std::uint32_t m_Version = 0x00000000;
+	static inline const std::uint32_t m_Version = 0x00000002;
 
 private:
 	std::string m_Name;
 	std::filesystem::path m_Path;
+	std::uint64_t m_Seed = GenerateRandomSeed();
 
 	Network m_Network;
 	ResourceDirectory m_Resources;
@@ -127,6 +129,8 @@ public:
 	void SetName(std::string newName) noexcept;
 	const std::filesystem::path& GetPath() const noexcept;
 	void SetPath(std::filesystem::path newPath) noexcept;
+	std::uint64_t GetSeed() const noexcept;
+	void SetSeed(std::uint64_t newSeed) noexcept;
 
 	const Network& GetNetwork() const noexcept;
 	Network& GetNetwork() noexcept;
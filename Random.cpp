@@ -0,0 +1,116 @@
+#include "Random.hpp"
+
+#include <atomic>
+#include <random>
+
+namespace {
+	constexpr std::uint32_t PhiloxMultiplier0 = 0xD2511F53;
+	constexpr std::uint32_t PhiloxMultiplier1 = 0xCD9E8D57;
+	constexpr std::uint32_t PhiloxWeyl0 = 0x9E3779B9;
+	constexpr std::uint32_t PhiloxWeyl1 = 0xBB67AE85;
+	constexpr std::size_t PhiloxRoundCount = 10;
+
+	std::atomic<std::uint64_t> g_RandomSeed = 0;
+	std::atomic<std::uint64_t> g_NextRandomStream = 0;
+
+	template<typename T>
+	T ToUniform(const Philox4x32::Counter& block, std::size_t lane) noexcept;
+
+	template<>
+	float ToUniform<float>(const Philox4x32::Counter& block, std::size_t lane) noexcept {
+		return (block[lane] >> 8) * 0x1p-24f;
+	}
+	template<>
+	double ToUniform<double>(const Philox4x32::Counter& block, std::size_t lane) noexcept {
+		const std::uint64_t bits = static_cast<std::uint64_t>(block[lane * 2]) << 32 | block[lane * 2 + 1];
+
+		return (bits >> 11) * 0x1p-53;
+	}
+}
+
+Philox4x32::Philox4x32(std::uint64_t seed, std::uint64_t stream) noexcept
+	: m_Key(MakeKey(seed)), m_Counter(MakeCounter(0, stream)) {}
+
+Philox4x32::result_type Philox4x32::operator()() noexcept {
+	if (m_OutputIndex == 4) {
+		m_Output = Generate(m_Key, m_Counter);
+		m_OutputIndex = 0;
+
+		if (++m_Counter[0] == 0) {
+			++m_Counter[1];
+		}
+	}
+
+	return m_Output[m_OutputIndex++];
+}
+
+Philox4x32::Key Philox4x32::MakeKey(std::uint64_t seed) noexcept {
+	return { static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) };
+}
+Philox4x32::Counter Philox4x32::MakeCounter(std::uint64_t blockIndex, std::uint64_t stream) noexcept {
+	return {
+		static_cast<std::uint32_t>(blockIndex), static_cast<std::uint32_t>(blockIndex >> 32),
+		static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32),
+	};
+}
+Philox4x32::Counter Philox4x32::Generate(const Key& key, Counter counter) noexcept {
+	Key roundKey = key;
+
+	for (std::size_t i = 0; i < PhiloxRoundCount; ++i) {
+		const std::uint64_t product0 = static_cast<std::uint64_t>(PhiloxMultiplier0) * counter[0];
+		const std::uint64_t product1 = static_cast<std::uint64_t>(PhiloxMultiplier1) * counter[2];
+
+		counter = {
+			static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ roundKey[0],
+			static_cast<std::uint32_t>(product1),
+			static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ roundKey[1],
+			static_cast<std::uint32_t>(product0),
+		};
+
+		roundKey[0] += PhiloxWeyl0;
+		roundKey[1] += PhiloxWeyl1;
+	}
+
+	return counter;
+}
+
+template<typename T>
+void GenerateUniform(std::uint64_t seed, std::uint64_t stream, std::uint64_t offset, std::size_t n,
+	T min, T max, T* y) noexcept {
+	constexpr std::size_t elementsPerBlock = sizeof(Philox4x32::Counter) / sizeof(T);
+
+	const Philox4x32::Key key = Philox4x32::MakeKey(seed);
+	const T range = max - min;
+
+	std::uint64_t blockIndex = offset / elementsPerBlock;
+	std::size_t lane = offset % elementsPerBlock;
+	Philox4x32::Counter block = Philox4x32::Generate(key, Philox4x32::MakeCounter(blockIndex, stream));
+
+	for (std::size_t i = 0; i < n; ++i) {
+		if (lane == elementsPerBlock) {
+			block = Philox4x32::Generate(key, Philox4x32::MakeCounter(++blockIndex, stream));
+			lane = 0;
+		}
+
+		y[i] = min + range * ToUniform<T>(block, lane++);
+	}
+}
+
+template void GenerateUniform<float>(std::uint64_t, std::uint64_t, std::uint64_t, std::size_t, float, float, float*) noexcept;
+template void GenerateUniform<double>(std::uint64_t, std::uint64_t, std::uint64_t, std::size_t, double, double, double*) noexcept;
+
+std::uint64_t GenerateRandomSeed() {
+	std::random_device device;
+
+	return static_cast<std::uint64_t>(device()) << 32 | device();
+}
+std::uint64_t GetRandomSeed() noexcept {
+	return g_RandomSeed.load(std::memory_order_relaxed);
+}
+void SetRandomSeed(std::uint64_t newSeed) noexcept {
+	g_RandomSeed.store(newSeed, std::memory_order_relaxed);
+	g_NextRandomStream.store(0, std::memory_order_relaxed);
+}
+std::uint64_t AcquireRandomStream() noexcept {
+	return g_NextRandomStream.fetch_add(1, std::memory_order_relaxed);
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+class Philox4x32 final {
+public:
+	using result_type = std::uint32_t;
+	using Counter = std::array<std::uint32_t, 4>;
+	using Key = std::array<std::uint32_t, 2>;
+
+private:
+	Key m_Key;
+	Counter m_Counter;
+	Counter m_Output{};
+	std::size_t m_OutputIndex = 4;
+
+public:
+	explicit Philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept;
+	Philox4x32(const Philox4x32&) noexcept = default;
+	~Philox4x32() = default;
+
+public:
+	Philox4x32& operator=(const Philox4x32&) noexcept = default;
+	result_type operator()() noexcept;
+
+public:
+	static constexpr result_type min() noexcept {
+		return 0;
+	}
+	static constexpr result_type max() noexcept {
+		return std::numeric_limits<result_type>::max();
+	}
+
+	static Key MakeKey(std::uint64_t seed) noexcept;
+	static Counter MakeCounter(std::uint64_t blockIndex, std::uint64_t stream) noexcept;
+	static Counter Generate(const Key& key, Counter counter) noexcept;
+};
+
+template<typename T>
+void GenerateUniform(std::uint64_t seed, std::uint64_t stream, std::uint64_t offset, std::size_t n,
+	T min, T max, T* y) noexcept;
+
+std::uint64_t GenerateRandomSeed();
+std::uint64_t GetRandomSeed() noexcept;
+void SetRandomSeed(std::uint64_t newSeed) noexcept;
+std::uint64_t AcquireRandomStream() noexcept;
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+inline constexpr std::size_t StaticUnrollLimit = 16;
+
+template<std::size_t N, typename Function>
+constexpr void StaticFor(Function&& function) {
+	if constexpr (N <= StaticUnrollLimit) {
+		[&]<std::size_t... I>(std::index_sequence<I...>) {
+			(function(I), ...);
+		}(std::make_index_sequence<N>{});
+	} else {
+		for (std::size_t i = 0; i < N; ++i) {
+			function(i);
+		}
+	}
+}
+
+template<std::size_t R, std::size_t C>
+class StaticMatrix final {
+	static_assert(R > 0 && C > 0);
+
+public:
+	using ValueType = float;
+
+	static constexpr std::size_t RowSize = R;
+	static constexpr std::size_t ColumnSize = C;
+
+private:
+	std::array<float, R * C> m_Elements{};
+
+public:
+	constexpr StaticMatrix() noexcept = default;
+	constexpr explicit StaticMatrix(float initialValue) noexcept {
+		m_Elements.fill(initialValue);
+	}
+	constexpr StaticMatrix(const std::array<float, R * C>& elements) noexcept
+		: m_Elements(elements) {}
+	explicit StaticMatrix(ConstMatrixView matrix) noexcept {
+		Assign(matrix);
+	}
+	constexpr StaticMatrix(const StaticMatrix& other) noexcept = default;
+	~StaticMatrix() = default;
+
+public:
+	constexpr StaticMatrix& operator=(const StaticMatrix& other) noexcept = default;
+	constexpr bool operator==(const StaticMatrix& other) const noexcept = default;
+	constexpr float operator()(std::size_t rowIndex, std::size_t columnIndex) const noexcept {
+		assert(rowIndex < R && columnIndex < C);
+
+		return m_Elements[rowIndex * C + columnIndex];
+	}
+	constexpr float& operator()(std::size_t rowIndex, std::size_t columnIndex) noexcept {
+		assert(rowIndex < R && columnIndex < C);
+
+		return m_Elements[rowIndex * C + columnIndex];
+	}
+	constexpr StaticMatrix& operator+=(const StaticMatrix& other) noexcept {
+		StaticFor<R * C>([&](std::size_t i) { m_Elements[i] += other.m_Elements[i]; });
+
+		return *this;
+	}
+	constexpr StaticMatrix& operator-=(const StaticMatrix& other) noexcept {
+		StaticFor<R * C>([&](std::size_t i) { m_Elements[i] -= other.m_Elements[i]; });
+
+		return *this;
+	}
+	constexpr StaticMatrix& operator*=(float other) noexcept {
+		StaticFor<R * C>([&](std::size_t i) { m_Elements[i] *= other; });
+
+		return *this;
+	}
+	operator ConstMatrixView() const noexcept {
+		return ConstMatrixView(m_Elements.data(), R, C, C);
+	}
+	operator MatrixView() noexcept {
+		return MatrixView(m_Elements.data(), R, C, C);
+	}
+
+public:
+	static constexpr std::pair<std::size_t, std::size_t> GetSize() noexcept {
+		return { R, C };
+	}
+	static constexpr std::size_t GetRowSize() noexcept {
+		return R;
+	}
+	static constexpr std::size_t GetColumnSize() noexcept {
+		return C;
+	}
+	static constexpr std::size_t GetStride() noexcept {
+		return C;
+	}
+	constexpr const float* GetData() const noexcept {
+		return m_Elements.data();
+	}
+	constexpr float* GetData() noexcept {
+		return m_Elements.data();
+	}
+
+	void Assign(ConstMatrixView matrix) noexcept {
+		assert(matrix.GetRowSize() == R && matrix.GetColumnSize() == C);
+
+		for (std::size_t i = 0; i < R; ++i) {
+			for (std::size_t j = 0; j < C; ++j) {
+				m_Elements[i * C + j] = matrix(i, j);
+			}
+		}
+	}
+	Matrix ToMatrix() const {
+		Matrix result(R, C);
+
+		Copy(result, *this);
+
+		return result;
+	}
+
+	constexpr StaticMatrix& HadamardProduct(const StaticMatrix& other) noexcept {
+		StaticFor<R * C>([&](std::size_t i) { m_Elements[i] *= other.m_Elements[i]; });
+
+		return *this;
+	}
+	template<typename Function>
+	constexpr StaticMatrix& Apply(Function&& function) noexcept {
+		StaticFor<R * C>([&](std::size_t i) { m_Elements[i] = function(m_Elements[i]); });
+
+		return *this;
+	}
+};
+
+template<std::size_t R, std::size_t C>
+constexpr StaticMatrix<R, C> operator+(StaticMatrix<R, C> lhs, const StaticMatrix<R, C>& rhs) noexcept {
+	return lhs += rhs;
+}
+template<std::size_t R, std::size_t C>
+constexpr StaticMatrix<R, C> operator-(StaticMatrix<R, C> lhs, const StaticMatrix<R, C>& rhs) noexcept {
+	return lhs -= rhs;
+}
+template<std::size_t R, std::size_t C>
+constexpr StaticMatrix<R, C> operator*(StaticMatrix<R, C> lhs, float rhs) noexcept {
+	return lhs *= rhs;
+}
+template<std::size_t R, std::size_t C>
+constexpr StaticMatrix<R, C> operator*(float lhs, StaticMatrix<R, C> rhs) noexcept {
+	return rhs *= lhs;
+}
+
+template<std::size_t R, std::size_t K, std::size_t C>
+constexpr void MultiplyAdd(StaticMatrix<R, C>& destination,
+	const StaticMatrix<R, K>& lhs, const StaticMatrix<K, C>& rhs) noexcept {
+	StaticFor<R>([&](std::size_t i) {
+		StaticFor<K>([&](std::size_t k) {
+			const float a = lhs(i, k);
+
+			StaticFor<C>([&](std::size_t j) { destination(i, j) += a * rhs(k, j); });
+		});
+	});
+}
+template<std::size_t R, std::size_t K, std::size_t C>
+constexpr StaticMatrix<R, C> operator*(const StaticMatrix<R, K>& lhs, const StaticMatrix<K, C>& rhs) noexcept {
+	StaticMatrix<R, C> result;
+
+	MultiplyAdd(result, lhs, rhs);
+
+	return result;
+}
+
+template<std::size_t R, std::size_t C>
+constexpr StaticMatrix<C, R> Transpose(const StaticMatrix<R, C>& matrix) noexcept {
+	StaticMatrix<C, R> result;
+
+	StaticFor<R>([&](std::size_t i) {
+		StaticFor<C>([&](std::size_t j) { result(j, i) = matrix(i, j); });
+	});
+
+	return result;
+}
+
+template<std::size_t R, std::size_t C>
+std::ostream& operator<<(std::ostream& stream, const StaticMatrix<R, C>& matrix) {
+	return stream << matrix.ToMatrix();
+}
\ No newline at end of file
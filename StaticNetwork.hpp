@@ -0,0 +1,171 @@
+#pragma once
+
+#include "Layer.hpp"
+#include "Network.hpp"
+#include "StaticMatrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+template<std::size_t InputSize, std::size_t OutputSize>
+class StaticFCLayer final {
+public:
+	static constexpr std::size_t ForwardInputSize = InputSize;
+	static constexpr std::size_t ForwardOutputSize = OutputSize;
+
+private:
+	StaticMatrix<OutputSize, InputSize> m_Weights;
+	StaticMatrix<OutputSize, 1> m_Biases;
+
+public:
+	void Load(const Layer& layer) {
+		const auto fcLayer = dynamic_cast<const FCLayer*>(&layer);
+
+		if (fcLayer == nullptr) throw std::runtime_error("Layer is not a fully connected layer");
+		if (fcLayer->GetForwardInputSize() != InputSize || fcLayer->GetForwardOutputSize() != OutputSize)
+			throw std::runtime_error("Fully connected layer size mismatch");
+
+		const ParameterTable& parameterTable = fcLayer->GetParameterTable();
+
+		m_Weights.Assign(parameterTable.GetParameter("Weights").GetExpandedValue());
+		m_Biases.Assign(parameterTable.GetParameter("Biases").GetExpandedValue());
+	}
+
+	template<std::size_t BatchSize>
+	StaticMatrix<OutputSize, BatchSize> Forward(const StaticMatrix<InputSize, BatchSize>& input) const noexcept {
+		StaticMatrix<OutputSize, BatchSize> output;
+
+		StaticFor<OutputSize>([&](std::size_t i) {
+			StaticFor<BatchSize>([&](std::size_t j) { output(i, j) = m_Biases(i, 0); });
+		});
+		MultiplyAdd(output, m_Weights, input);
+
+		return output;
+	}
+};
+
+template<AFunction Function>
+float StaticActivate(float x) noexcept {
+	if constexpr (Function == AFunction::Sigmoid) {
+		return 1 / (1 + std::exp(-x));
+	} else if constexpr (Function == AFunction::Tanh) {
+		return std::tanh(x);
+	} else if constexpr (Function == AFunction::ReLU) {
+		return std::max(x, 0.f);
+	} else {
+		return std::max(0.01f * x, x);
+	}
+}
+
+template<AFunction Function, std::size_t Size>
+class StaticALayer final {
+public:
+	static constexpr std::size_t ForwardInputSize = Size;
+	static constexpr std::size_t ForwardOutputSize = Size;
+
+public:
+	void Load(const Layer& layer) {
+		const auto aLayer = dynamic_cast<const ALayer*>(&layer);
+
+		if (aLayer == nullptr || aLayer->GetAFunction() != Function)
+			throw std::runtime_error("Activation layer mismatch");
+	}
+
+	template<std::size_t BatchSize>
+	StaticMatrix<Size, BatchSize> Forward(StaticMatrix<Size, BatchSize> input) const noexcept {
+		return input.Apply(StaticActivate<Function>);
+	}
+};
+
+template<std::size_t Size>
+class StaticSMLayer final {
+public:
+	static constexpr std::size_t ForwardInputSize = Size;
+	static constexpr std::size_t ForwardOutputSize = Size;
+
+public:
+	void Load(const Layer& layer) {
+		if (dynamic_cast<const SMLayer*>(&layer) == nullptr) throw std::runtime_error("Layer is not a softmax layer");
+	}
+
+	template<std::size_t BatchSize>
+	StaticMatrix<Size, BatchSize> Forward(StaticMatrix<Size, BatchSize> input) const noexcept {
+		StaticFor<BatchSize>([&](std::size_t j) {
+			float max = input(0, j), sum = 0;
+
+			StaticFor<Size>([&](std::size_t i) { max = std::max(max, input(i, j)); });
+			StaticFor<Size>([&](std::size_t i) { sum += input(i, j) = std::exp(input(i, j) - max); });
+			StaticFor<Size>([&](std::size_t i) { input(i, j) /= sum; });
+		});
+
+		return input;
+	}
+};
+
+template<typename... Layers>
+class StaticNetwork final {
+	static_assert(sizeof...(Layers) > 0);
+
+private:
+	using FirstLayer = std::tuple_element_t<0, std::tuple<Layers...>>;
+	using LastLayer = std::tuple_element_t<sizeof...(Layers) - 1, std::tuple<Layers...>>;
+
+public:
+	static constexpr std::size_t InputSize = FirstLayer::ForwardInputSize;
+	static constexpr std::size_t OutputSize = LastLayer::ForwardOutputSize;
+
+	template<std::size_t BatchSize = 1>
+	using Input = StaticMatrix<InputSize, BatchSize>;
+	template<std::size_t BatchSize = 1>
+	using Output = StaticMatrix<OutputSize, BatchSize>;
+
+private:
+	static_assert([]<std::size_t... I>(std::index_sequence<I...>) {
+		return ((std::tuple_element_t<I, std::tuple<Layers...>>::ForwardOutputSize ==
+			std::tuple_element_t<I + 1, std::tuple<Layers...>>::ForwardInputSize) && ...);
+	}(std::make_index_sequence<sizeof...(Layers) - 1>{}), "Adjacent layer sizes must match");
+
+	std::tuple<Layers...> m_Layers;
+
+public:
+	StaticNetwork() noexcept = default;
+	explicit StaticNetwork(const Network& network) {
+		Load(network);
+	}
+	StaticNetwork(const StaticNetwork& other) noexcept = default;
+	~StaticNetwork() = default;
+
+public:
+	StaticNetwork& operator=(const StaticNetwork& other) noexcept = default;
+
+public:
+	void Load(const Network& network) {
+		if (network.GetLayerCount() != sizeof...(Layers)) throw std::runtime_error("Layer count mismatch");
+
+		std::apply([&](auto&... layers) {
+			std::size_t index = 0;
+
+			(layers.Load(network.GetLayer(index++)), ...);
+		}, m_Layers);
+	}
+
+	template<std::size_t BatchSize>
+	Output<BatchSize> Forward(const Input<BatchSize>& input) const noexcept {
+		return ForwardImpl<0>(input);
+	}
+
+private:
+	template<std::size_t LayerIndex, typename Value>
+	auto ForwardImpl(const Value& value) const noexcept {
+		if constexpr (LayerIndex == sizeof...(Layers)) {
+			return value;
+		} else {
+			return ForwardImpl<LayerIndex + 1>(std::get<LayerIndex>(m_Layers).Forward(value));
+		}
+	}
+};
\ No newline at end of file
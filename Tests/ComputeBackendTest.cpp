@@ -0,0 +1,288 @@
+#include "../ComputeBackend.hpp"
+#include "../MatrixKernel.hpp"
+#include "../Random.hpp"
+#include "../ThreadPool.hpp"
+#include "../VectorKernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	constexpr std::size_t LargeElementCount = (std::size_t(1) << 19) + 5;
+	constexpr float Epsilon = 1.1920929e-7f;
+
+	Philox4x32 g_RandomEngine(0x5A4D);
+	std::size_t g_CheckCount = 0;
+	std::size_t g_FailureCount = 0;
+
+	std::vector<float> RandomVector(std::size_t n, float min = -1.f, float max = 1.f) {
+		std::uniform_real_distribution<float> distribution(min, max);
+		std::vector<float> result(n);
+
+		for (float& element : result) {
+			element = distribution(g_RandomEngine);
+		}
+
+		return result;
+	}
+
+	void ExpectNear(const ComputeBackend& backend, const std::string& name,
+		const std::vector<float>& actual, const std::vector<float>& expected,
+		const std::function<float(std::size_t)>& tolerance) {
+		++g_CheckCount;
+
+		for (std::size_t i = 0; i < expected.size(); ++i) {
+			const float error = std::abs(actual[i] - expected[i]);
+
+			if (actual[i] == expected[i] || error <= tolerance(i)) continue;
+
+			std::printf("[%s] %s: element %zu is %.9g, expected %.9g (tolerance %.3g)\n",
+				std::string(backend.GetName()).c_str(), name.c_str(), i, actual[i], expected[i], tolerance(i));
+			++g_FailureCount;
+
+			return;
+		}
+	}
+	void ExpectNear(const ComputeBackend& backend, const std::string& name,
+		const std::vector<float>& actual, const std::vector<float>& expected,
+		float absoluteTolerance, float relativeTolerance) {
+		ExpectNear(backend, name, actual, expected, [&](std::size_t i) {
+			return absoluteTolerance + relativeTolerance * std::abs(expected[i]);
+		});
+	}
+
+	void TestGemm(const ComputeBackend& backend, bool transposeA, bool transposeB,
+		std::size_t m, std::size_t n, std::size_t k, float alpha, float beta) {
+		const std::size_t lda = (transposeA ? m : k) + 3, ldb = (transposeB ? k : n) + 1, ldc = n + 2;
+		const std::vector<float> a = RandomVector((transposeA ? k : m) * lda);
+		const std::vector<float> b = RandomVector((transposeB ? n : k) * ldb);
+		const std::vector<float> c = RandomVector(m * ldc);
+
+		std::vector<float> expected = c, actual = c;
+
+		ReferenceBackend->Gemm(transposeA, transposeB, m, n, k, alpha, a.data(), lda, b.data(), ldb,
+			beta, expected.data(), ldc);
+		backend.Gemm(transposeA, transposeB, m, n, k, alpha, a.data(), lda, b.data(), ldb,
+			beta, actual.data(), ldc);
+
+		const std::string name = std::string("Gemm ") + (transposeA ? 'T' : 'N') + (transposeB ? 'T' : 'N') +
+			' ' + std::to_string(m) + 'x' + std::to_string(n) + 'x' + std::to_string(k);
+
+		ExpectNear(backend, name, actual, expected, [&](std::size_t i) {
+			return 4 * Epsilon * (k * std::abs(alpha) + std::abs(beta * c[i])) + 1e-6f;
+		});
+	}
+	void TestGemm(const ComputeBackend& backend) {
+		static constexpr std::size_t ms[] = { 1, 2, 7, 13, 31, 64 };
+		static constexpr std::size_t ns[] = { 1, 3, 8, 15, 17, 33 };
+		static constexpr std::size_t ks[] = { 1, 5, 16, 63, 257 };
+
+		for (const bool transposeA : { false, true }) {
+			for (const bool transposeB : { false, true }) {
+				std::size_t index = 0;
+
+				for (const std::size_t m : ms) {
+					for (const std::size_t n : ns) {
+						for (const std::size_t k : ks) {
+							const bool isScaled = index++ % 2 == 1;
+
+							TestGemm(backend, transposeA, transposeB, m, n, k, isScaled ? 0.5f : 1.f, isScaled ? -2.f : 0.f);
+						}
+					}
+				}
+
+				TestGemm(backend, transposeA, transposeB, 301, 257, 203, 1.f, 0.f);
+				TestGemm(backend, transposeA, transposeB, 130, 7, 517, 0.5f, 1.f);
+			}
+		}
+	}
+	void TestGemmThreadCount(const ComputeBackend& backend, std::size_t m, std::size_t n, std::size_t k) {
+		const std::vector<float> a = RandomVector(m * k);
+		const std::vector<float> b = RandomVector(k * n);
+		const std::vector<float> c = RandomVector(m * n);
+		const GemmParameters previousParameters = GetGemmParameters();
+		GemmParameters parameters = previousParameters;
+
+		parameters.ParallelThreshold = 0;
+		SetGemmParameters(parameters);
+
+		std::vector<float> expected;
+
+		for (const std::size_t threadCount : { 1, 2, 3, 4, 7, 8 }) {
+			std::vector<float> actual = c;
+
+			SetGemmThreadCount(threadCount);
+			backend.Gemm(false, false, m, n, k, 0.5f, a.data(), k, b.data(), n, 1.f, actual.data(), n);
+
+			if (expected.empty()) {
+				expected = std::move(actual);
+			} else {
+				ExpectNear(backend, "Gemm " + std::to_string(m) + 'x' + std::to_string(n) + 'x' + std::to_string(k) +
+					" with " + std::to_string(threadCount) + " threads", actual, expected, 0.f, 0.f);
+			}
+		}
+
+		SetGemmParameters(previousParameters);
+		SetGemmThreadCount(4);
+	}
+
+	void TestGemv(const ComputeBackend& backend, bool transposeA, std::size_t m, std::size_t n,
+		std::size_t incx, std::size_t incy, float alpha, float beta) {
+		const std::size_t lda = n + 1;
+		const std::size_t xSize = transposeA ? m : n, ySize = transposeA ? n : m;
+		const std::vector<float> a = RandomVector(m * lda);
+		const std::vector<float> x = RandomVector(xSize * incx);
+		const std::vector<float> y = RandomVector(ySize * incy);
+
+		std::vector<float> expected = y, actual = y;
+
+		ReferenceBackend->Gemv(transposeA, m, n, alpha, a.data(), lda, x.data(), incx, beta, expected.data(), incy);
+		backend.Gemv(transposeA, m, n, alpha, a.data(), lda, x.data(), incx, beta, actual.data(), incy);
+
+		const std::string name = std::string("Gemv ") + (transposeA ? 'T' : 'N') + ' ' +
+			std::to_string(m) + 'x' + std::to_string(n) + " inc " + std::to_string(incx) + '/' + std::to_string(incy);
+
+		ExpectNear(backend, name, actual, expected, [&](std::size_t i) {
+			return 4 * Epsilon * (xSize * std::abs(alpha) + std::abs(beta * y[i])) + 1e-6f;
+		});
+	}
+	void TestGer(const ComputeBackend& backend, std::size_t m, std::size_t n, std::size_t incx, std::size_t incy,
+		float alpha) {
+		const std::size_t lda = n + 3;
+		const std::vector<float> x = RandomVector(m * incx);
+		const std::vector<float> y = RandomVector(n * incy);
+		const std::vector<float> a = RandomVector(m * lda);
+
+		std::vector<float> expected = a, actual = a;
+
+		ReferenceBackend->Ger(m, n, alpha, x.data(), incx, y.data(), incy, expected.data(), lda);
+		backend.Ger(m, n, alpha, x.data(), incx, y.data(), incy, actual.data(), lda);
+
+		ExpectNear(backend, "Ger " + std::to_string(m) + 'x' + std::to_string(n), actual, expected,
+			1e-6f, 4 * Epsilon);
+	}
+	void TestGemvAndGer(const ComputeBackend& backend) {
+		for (const bool transposeA : { false, true }) {
+			for (const auto& [m, n] : { std::pair<std::size_t, std::size_t>{ 1, 1 }, { 7, 3 }, { 17, 33 }, { 700, 509 } }) {
+				TestGemv(backend, transposeA, m, n, 1, 1, 1.f, 0.f);
+				TestGemv(backend, transposeA, m, n, 3, 2, -0.5f, 1.5f);
+			}
+		}
+
+		for (const auto& [m, n] : { std::pair<std::size_t, std::size_t>{ 1, 1 }, { 9, 2 }, { 31, 17 }, { 611, 523 } }) {
+			TestGer(backend, m, n, 1, 1, 1.f);
+			TestGer(backend, m, n, 2, 3, -0.25f);
+		}
+	}
+
+	void TestElementwise(const ComputeBackend& backend, std::size_t n) {
+		const std::vector<float> x = RandomVector(n, 0.5f, 2.f);
+		const std::vector<float> y = RandomVector(n);
+		const std::string suffix = ' ' + std::to_string(n);
+		const auto check = [&](const std::string& name, float absoluteTolerance, const auto& function) {
+			std::vector<float> expected = y, actual = y;
+
+			function(*ReferenceBackend, expected.data());
+			function(backend, actual.data());
+
+			ExpectNear(backend, name + suffix, actual, expected, absoluteTolerance, 0.f);
+		};
+
+		check("Add", 0.f, [&](const ComputeBackend& target, float* data) { target.Add(n, x.data(), data); });
+		check("Subtract", 0.f, [&](const ComputeBackend& target, float* data) { target.Subtract(n, x.data(), data); });
+		check("Multiply", 0.f, [&](const ComputeBackend& target, float* data) { target.Multiply(n, x.data(), data); });
+		check("Divide", 0.f, [&](const ComputeBackend& target, float* data) { target.Divide(n, x.data(), data); });
+		check("Max", 0.f, [&](const ComputeBackend& target, float* data) { target.Max(n, x.data(), data); });
+		check("Scale", 0.f, [&](const ComputeBackend& target, float* data) { target.Scale(n, -1.75f, data); });
+		check("Axpy", 8 * Epsilon, [&](const ComputeBackend& target, float* data) {
+			target.Axpy(n, 0.3f, x.data(), data);
+		});
+		check("AddScalar", 0.f, [&](const ComputeBackend& target, float* data) { target.AddScalar(n, 0.25f, data); });
+		check("ReLU", 0.f, [&](const ComputeBackend& target, float* data) { target.ReLU(n, 0.f, data); });
+		check("LeakyReLU", 0.f, [&](const ComputeBackend& target, float* data) { target.ReLU(n, 0.01f, data); });
+		check("ReLUDerivative", 0.f, [&](const ComputeBackend& target, float* data) {
+			target.ReLUDerivative(n, 0.01f, data);
+		});
+	}
+	void TestReductions(const ComputeBackend& backend, std::size_t n) {
+		const std::vector<float> x = RandomVector(n);
+		const std::vector<float> y = RandomVector(n);
+
+		float absoluteSum = 0.f, distanceBound = 0.f;
+
+		for (std::size_t i = 0; i < n; ++i) {
+			absoluteSum += std::abs(x[i]);
+			distanceBound += (x[i] - y[i]) * (x[i] - y[i]);
+		}
+
+		const std::string suffix = ' ' + std::to_string(n);
+
+		ExpectNear(backend, "Sum" + suffix, { backend.Sum(n, x.data()) }, { ReferenceBackend->Sum(n, x.data()) },
+			1e-4f * absoluteSum + 1e-6f, 0.f);
+		ExpectNear(backend, "SquaredDistance" + suffix,
+			{ backend.SquaredDistance(n, x.data(), y.data()) }, { ReferenceBackend->SquaredDistance(n, x.data(), y.data()) },
+			1e-4f * distanceBound + 1e-6f, 0.f);
+	}
+
+	void TestActivations(const ComputeBackend& backend, MathAccuracy accuracy, std::size_t n) {
+		const bool isFast = accuracy == MathAccuracy::Fast;
+		const std::string suffix = std::string(isFast ? " fast " : " precise ") + std::to_string(n);
+		const auto check = [&](const std::string& name, float min, float max,
+			float absoluteTolerance, float relativeTolerance, void (ComputeBackend::*function)(std::size_t, float*) const) {
+			const std::vector<float> x = RandomVector(n, min, max);
+			std::vector<float> expected = x, actual = x;
+
+			(ReferenceBackend.get()->*function)(n, expected.data());
+			(backend.*function)(n, actual.data());
+
+			ExpectNear(backend, name + suffix, actual, expected, absoluteTolerance, relativeTolerance);
+		};
+
+		SetMathAccuracy(accuracy);
+
+		check("Exp", -80.f, 80.f, 0.f, isFast ? 1e-4f : 1e-6f, &ComputeBackend::Exp);
+		check("Log", 1e-30f, 1e4f, isFast ? 1e-4f : 1e-6f, isFast ? 5e-4f : 1e-6f, &ComputeBackend::Log);
+		check("Tanh", -20.f, 20.f, isFast ? 1e-4f : 1e-6f, isFast ? 1e-3f : 4e-6f, &ComputeBackend::Tanh);
+		check("Sigmoid", -30.f, 30.f, isFast ? 1e-4f : 1e-6f, isFast ? 1e-3f : 4e-6f, &ComputeBackend::Sigmoid);
+		check("TanhDerivative", -20.f, 20.f, isFast ? 1e-4f : 1e-6f, isFast ? 1e-3f : 1e-5f,
+			&ComputeBackend::TanhDerivative);
+		check("SigmoidDerivative", -30.f, 30.f, isFast ? 1e-4f : 1e-6f, isFast ? 1e-3f : 1e-5f,
+			&ComputeBackend::SigmoidDerivative);
+
+		SetMathAccuracy(MathAccuracy::Precise);
+	}
+}
+
+int main() {
+	GetDefaultThreadPool().SetThreadCount(4);
+	SetGemmThreadCount(4);
+
+	for (const ComputeBackend* const backend : { SimdBackend.get(), ParallelBackend.get() }) {
+		TestGemm(*backend);
+		TestGemvAndGer(*backend);
+
+		for (const std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(15), std::size_t(16),
+			std::size_t(17), std::size_t(1000), LargeElementCount }) {
+			TestElementwise(*backend, n);
+			TestReductions(*backend, n);
+			TestActivations(*backend, MathAccuracy::Precise, n);
+			TestActivations(*backend, MathAccuracy::Fast, n);
+		}
+	}
+
+	TestGemmThreadCount(*ParallelBackend, 64, 64, 16);
+	TestGemmThreadCount(*ParallelBackend, 200, 130, 33);
+	TestGemmThreadCount(*ParallelBackend, 33, 500, 20);
+
+	std::printf("%zu checks, %zu failures\n", g_CheckCount, g_FailureCount);
+
+	return g_FailureCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
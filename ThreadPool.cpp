@@ -0,0 +1,143 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace {
+	thread_local bool t_IsInsideThreadPool = false;
+}
+
+ThreadPool::ThreadPool(std::size_t threadCount) {
+	assert(threadCount > 0);
+
+	StartWorkers(threadCount - 1);
+}
+ThreadPool::~ThreadPool() {
+	StopWorkers();
+}
+
+std::size_t ThreadPool::GetThreadCount() const noexcept {
+	return m_ThreadCount.load(std::memory_order_relaxed);
+}
+void ThreadPool::SetThreadCount(std::size_t newThreadCount) {
+	assert(newThreadCount > 0);
+
+	std::lock_guard lock(m_RunMutex);
+
+	if (newThreadCount == GetThreadCount()) return;
+
+	StopWorkers();
+	StartWorkers(newThreadCount - 1);
+}
+
+void ThreadPool::Run(std::size_t taskCount, const std::function<void(std::size_t)>& task) {
+	std::unique_lock runLock(m_RunMutex, std::defer_lock);
+
+	if (taskCount <= 1 || t_IsInsideThreadPool || !runLock.try_lock() || m_Workers.empty()) {
+		for (std::size_t i = 0; i < taskCount; ++i) {
+			task(i);
+		}
+
+		return;
+	}
+
+	{
+		std::lock_guard lock(m_Mutex);
+
+		m_Task = &task;
+		m_TaskCount = taskCount;
+		m_NextTask.store(0, std::memory_order_relaxed);
+		m_ActiveWorkerCount = m_Workers.size();
+		++m_Generation;
+	}
+
+	m_WorkCondition.notify_all();
+
+	t_IsInsideThreadPool = true;
+	RunTasks();
+	t_IsInsideThreadPool = false;
+
+	std::unique_lock lock(m_Mutex);
+
+	m_DoneCondition.wait(lock, [this] { return m_ActiveWorkerCount == 0; });
+	m_Task = nullptr;
+
+	if (m_Exception) {
+		std::rethrow_exception(std::exchange(m_Exception, nullptr));
+	}
+}
+
+void ThreadPool::StartWorkers(std::size_t workerCount) {
+	m_IsStopping = false;
+
+	for (std::size_t i = 0; i < workerCount; ++i) {
+		m_Workers.emplace_back(&ThreadPool::WorkerMain, this, m_Generation);
+		m_ThreadCount.store(m_Workers.size() + 1, std::memory_order_relaxed);
+	}
+}
+void ThreadPool::StopWorkers() noexcept {
+	{
+		std::lock_guard lock(m_Mutex);
+
+		m_IsStopping = true;
+	}
+
+	m_WorkCondition.notify_all();
+
+	for (auto& worker : m_Workers) {
+		worker.join();
+	}
+
+	m_Workers.clear();
+	m_ThreadCount.store(1, std::memory_order_relaxed);
+}
+void ThreadPool::WorkerMain(std::size_t generation) {
+	t_IsInsideThreadPool = true;
+
+	while (true) {
+		{
+			std::unique_lock lock(m_Mutex);
+
+			m_WorkCondition.wait(lock, [this, generation] { return m_IsStopping || m_Generation != generation; });
+
+			if (m_IsStopping) return;
+
+			generation = m_Generation;
+		}
+
+		RunTasks();
+
+		std::lock_guard lock(m_Mutex);
+
+		if (--m_ActiveWorkerCount == 0) {
+			m_DoneCondition.notify_one();
+		}
+	}
+}
+void ThreadPool::RunTasks() noexcept {
+	const std::function<void(std::size_t)>& task = *m_Task;
+
+	for (std::size_t i; (i = m_NextTask.fetch_add(1, std::memory_order_relaxed)) < m_TaskCount;) {
+		try {
+			task(i);
+		} catch (...) {
+			std::lock_guard lock(m_Mutex);
+
+			if (!m_Exception) {
+				m_Exception = std::current_exception();
+			}
+
+			m_NextTask.store(m_TaskCount, std::memory_order_relaxed);
+		}
+	}
+}
+
+std::size_t GetHardwareThreadCount() noexcept {
+	return std::max(std::thread::hardware_concurrency(), 1u);
+}
+ThreadPool& GetDefaultThreadPool() {
+	static ThreadPool threadPool(GetHardwareThreadCount());
+
+	return threadPool;
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool final {
+private:
+	std::vector<std::thread> m_Workers;
+	std::atomic<std::size_t> m_ThreadCount = 1;
+	std::mutex m_RunMutex;
+
+	std::mutex m_Mutex;
+	std::condition_variable m_WorkCondition, m_DoneCondition;
+	std::size_t m_Generation = 0;
+	std::size_t m_ActiveWorkerCount = 0;
+	bool m_IsStopping = false;
+
+	const std::function<void(std::size_t)>* m_Task = nullptr;
+	std::size_t m_TaskCount = 0;
+	std::atomic<std::size_t> m_NextTask = 0;
+	std::exception_ptr m_Exception;
+
+public:
+	explicit ThreadPool(std::size_t threadCount);
+	ThreadPool(const ThreadPool&) = delete;
+	~ThreadPool();
+
+public:
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+public:
+	std::size_t GetThreadCount() const noexcept;
+	void SetThreadCount(std::size_t newThreadCount);
+
+	void Run(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+private:
+	void StartWorkers(std::size_t workerCount);
+	void StopWorkers() noexcept;
+	void WorkerMain(std::size_t generation);
+	void RunTasks() noexcept;
+};
+
+std::size_t GetHardwareThreadCount() noexcept;
+ThreadPool& GetDefaultThreadPool();
\ No newline at end of file
@@ -0,0 +1,703 @@
+#include "VectorKernel.hpp"
+
+#include "HalfFloat.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define SAM_X86
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#endif
+
+#if defined(__clang__)
+#	define SAM_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#	define SAM_UNROLL _Pragma("GCC unroll 16")
+#else
+#	define SAM_UNROLL
+#endif
+
+namespace {
+	constexpr std::size_t TransposeTileSize = 8;
+
+	namespace Scalar {
+		using Vector = float;
+		constexpr std::size_t Width = 1;
+
+		inline Vector Load(const float* pointer) noexcept { return *pointer; }
+		inline void Store(float* pointer, Vector value) noexcept { *pointer = value; }
+		inline Vector Broadcast(float value) noexcept { return value; }
+		inline Vector VAdd(Vector lhs, Vector rhs) noexcept { return lhs + rhs; }
+		inline Vector VSubtract(Vector lhs, Vector rhs) noexcept { return lhs - rhs; }
+		inline Vector VMultiply(Vector lhs, Vector rhs) noexcept { return lhs * rhs; }
+		inline Vector VMultiplyAdd(Vector lhs, Vector rhs, Vector addend) noexcept { return lhs * rhs + addend; }
+		inline Vector VDivide(Vector lhs, Vector rhs) noexcept { return lhs / rhs; }
+		inline Vector VMax(Vector lhs, Vector rhs) noexcept { return std::max(lhs, rhs); }
+		inline Vector SelectNonNegative(Vector value, Vector ifTrue, Vector ifFalse) noexcept {
+			return value >= 0.f ? ifTrue : ifFalse;
+		}
+		inline Vector VRound(Vector value) noexcept { return std::nearbyint(value); }
+		inline Vector Pow2(Vector exponent) noexcept {
+			const float clampedExponent = std::min(std::max(-127.f, exponent), 128.f);
+
+			return std::bit_cast<float>((static_cast<std::int32_t>(clampedExponent) + 127) << 23);
+		}
+		inline Vector Frexp(Vector value, Vector& exponent) noexcept {
+			const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+
+			exponent = static_cast<float>(static_cast<std::int32_t>((bits >> 23) & 0xFF) - 126);
+
+			return std::bit_cast<float>((bits & 0x807FFFFF) | 0x3F000000);
+		}
+		inline float ReduceAdd(Vector value) noexcept { return value; }
+		inline Vector LoadBFloat16(const std::uint16_t* pointer) noexcept { return BFloat16ToFloat(*pointer); }
+		inline void StoreBFloat16(std::uint16_t* pointer, Vector value) noexcept { *pointer = FloatToBFloat16(value); }
+		inline Vector LoadFloat16(const std::uint16_t* pointer) noexcept { return Float16ToFloat(*pointer); }
+		inline void StoreFloat16(std::uint16_t* pointer, Vector value) noexcept { *pointer = FloatToFloat16(value); }
+
+		using IntVector = std::int32_t;
+		constexpr std::size_t Int8Width = 1;
+
+		inline IntVector ZeroInt32() noexcept { return 0; }
+		inline IntVector MultiplyAddInt8(IntVector sum, const std::int8_t* x, const std::int8_t* y) noexcept {
+			return sum + *x * *y;
+		}
+		inline std::int32_t ReduceAddInt32(IntVector value) noexcept { return value; }
+
+		inline void TransposeTile(const float* x, std::size_t ldx, float* y, std::size_t ldy) noexcept {
+			for (std::size_t i = 0; i < TransposeTileSize; ++i) {
+				for (std::size_t j = 0; j < TransposeTileSize; ++j) {
+					y[j * ldy + i] = x[i * ldx + j];
+				}
+			}
+		}
+
+#include "VectorKernel.inl"
+	}
+
+#ifdef SAM_X86
+	namespace SSE2 {
+		using Vector = __m128;
+		constexpr std::size_t Width = 4;
+
+		inline Vector Load(const float* pointer) noexcept { return _mm_loadu_ps(pointer); }
+		inline void Store(float* pointer, Vector value) noexcept { _mm_storeu_ps(pointer, value); }
+		inline Vector Broadcast(float value) noexcept { return _mm_set1_ps(value); }
+		inline Vector VAdd(Vector lhs, Vector rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+		inline Vector VSubtract(Vector lhs, Vector rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+		inline Vector VMultiply(Vector lhs, Vector rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+		inline Vector VMultiplyAdd(Vector lhs, Vector rhs, Vector addend) noexcept { return _mm_add_ps(_mm_mul_ps(lhs, rhs), addend); }
+		inline Vector VDivide(Vector lhs, Vector rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+		inline Vector VMax(Vector lhs, Vector rhs) noexcept { return _mm_max_ps(lhs, rhs); }
+		inline Vector SelectNonNegative(Vector value, Vector ifTrue, Vector ifFalse) noexcept {
+			const Vector mask = _mm_cmpge_ps(value, _mm_setzero_ps());
+
+			return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+		}
+		inline Vector VRound(Vector value) noexcept { return _mm_cvtepi32_ps(_mm_cvtps_epi32(value)); }
+		inline Vector Pow2(Vector exponent) noexcept {
+			const Vector clampedExponent = _mm_min_ps(_mm_max_ps(exponent, _mm_set1_ps(-127.f)), _mm_set1_ps(128.f));
+
+			return _mm_castsi128_ps(_mm_slli_epi32(
+				_mm_add_epi32(_mm_cvtps_epi32(clampedExponent), _mm_set1_epi32(127)), 23));
+		}
+		inline Vector Frexp(Vector value, Vector& exponent) noexcept {
+			const __m128i bits = _mm_castps_si128(value);
+
+			exponent = _mm_cvtepi32_ps(_mm_sub_epi32(
+				_mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7F800000)), 23), _mm_set1_epi32(126)));
+
+			return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x807FFFFF))),
+				_mm_set1_epi32(0x3F000000)));
+		}
+		inline float ReduceAdd(Vector value) noexcept {
+			const Vector high = _mm_movehl_ps(value, value);
+			const Vector pair = _mm_add_ps(value, high);
+
+			return _mm_cvtss_f32(_mm_add_ss(pair, _mm_shuffle_ps(pair, pair, 1)));
+		}
+		inline Vector LoadBFloat16(const std::uint16_t* pointer) noexcept {
+			const __m128i value = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pointer));
+
+			return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), value));
+		}
+		inline void StoreBFloat16(std::uint16_t* pointer, Vector value) noexcept {
+			const __m128i bits = _mm_castps_si128(value);
+			const __m128i high = _mm_srli_epi32(bits, 16);
+			const __m128i rounded = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(0x7FFF)),
+				_mm_and_si128(high, _mm_set1_epi32(1))), 16);
+			const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(value, value));
+			__m128i result = _mm_or_si128(_mm_andnot_si128(nan, rounded),
+				_mm_and_si128(nan, _mm_or_si128(high, _mm_set1_epi32(0x40))));
+
+			result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pointer), _mm_packs_epi32(result, result));
+		}
+		inline Vector LoadFloat16(const std::uint16_t* pointer) noexcept {
+			return _mm_setr_ps(Float16ToFloat(pointer[0]), Float16ToFloat(pointer[1]),
+				Float16ToFloat(pointer[2]), Float16ToFloat(pointer[3]));
+		}
+		inline void StoreFloat16(std::uint16_t* pointer, Vector value) noexcept {
+			alignas(16) float values[Width];
+			_mm_store_ps(values, value);
+
+			for (std::size_t i = 0; i < Width; ++i) {
+				pointer[i] = FloatToFloat16(values[i]);
+			}
+		}
+
+		using IntVector = __m128i;
+		constexpr std::size_t Int8Width = 8;
+
+		inline IntVector ZeroInt32() noexcept { return _mm_setzero_si128(); }
+		inline IntVector MultiplyAddInt8(IntVector sum, const std::int8_t* x, const std::int8_t* y) noexcept {
+			const __m128i xBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(x));
+			const __m128i yBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(y));
+			const __m128i xWords = _mm_srai_epi16(_mm_unpacklo_epi8(xBytes, xBytes), 8);
+			const __m128i yWords = _mm_srai_epi16(_mm_unpacklo_epi8(yBytes, yBytes), 8);
+
+			return _mm_add_epi32(sum, _mm_madd_epi16(xWords, yWords));
+		}
+		inline std::int32_t ReduceAddInt32(IntVector value) noexcept {
+			const __m128i pair = _mm_add_epi32(value, _mm_shuffle_epi32(value, 0x4E));
+
+			return _mm_cvtsi128_si32(_mm_add_epi32(pair, _mm_shuffle_epi32(pair, 0xB1)));
+		}
+
+		inline void TransposeTile(const float* x, std::size_t ldx, float* y, std::size_t ldy) noexcept {
+			for (std::size_t i = 0; i < TransposeTileSize; i += 4) {
+				for (std::size_t j = 0; j < TransposeTileSize; j += 4) {
+					Vector row0 = Load(x + i * ldx + j), row1 = Load(x + (i + 1) * ldx + j);
+					Vector row2 = Load(x + (i + 2) * ldx + j), row3 = Load(x + (i + 3) * ldx + j);
+
+					_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+					Store(y + j * ldy + i, row0);
+					Store(y + (j + 1) * ldy + i, row1);
+					Store(y + (j + 2) * ldy + i, row2);
+					Store(y + (j + 3) * ldy + i, row3);
+				}
+			}
+		}
+
+#include "VectorKernel.inl"
+	}
+
+#	if defined(__clang__)
+#		pragma clang attribute push(__attribute__((target("avx2,fma,f16c"))), apply_to = function)
+#	elif defined(__GNUC__)
+#		pragma GCC push_options
+#		pragma GCC target("avx2,fma,f16c")
+#	endif
+	namespace AVX2 {
+		using Vector = __m256;
+		constexpr std::size_t Width = 8;
+
+		inline Vector Load(const float* pointer) noexcept { return _mm256_loadu_ps(pointer); }
+		inline void Store(float* pointer, Vector value) noexcept { _mm256_storeu_ps(pointer, value); }
+		inline Vector Broadcast(float value) noexcept { return _mm256_set1_ps(value); }
+		inline Vector VAdd(Vector lhs, Vector rhs) noexcept { return _mm256_add_ps(lhs, rhs); }
+		inline Vector VSubtract(Vector lhs, Vector rhs) noexcept { return _mm256_sub_ps(lhs, rhs); }
+		inline Vector VMultiply(Vector lhs, Vector rhs) noexcept { return _mm256_mul_ps(lhs, rhs); }
+		inline Vector VMultiplyAdd(Vector lhs, Vector rhs, Vector addend) noexcept { return _mm256_fmadd_ps(lhs, rhs, addend); }
+		inline Vector VDivide(Vector lhs, Vector rhs) noexcept { return _mm256_div_ps(lhs, rhs); }
+		inline Vector VMax(Vector lhs, Vector rhs) noexcept { return _mm256_max_ps(lhs, rhs); }
+		inline Vector SelectNonNegative(Vector value, Vector ifTrue, Vector ifFalse) noexcept {
+			return _mm256_blendv_ps(ifFalse, ifTrue, _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ));
+		}
+		inline Vector VRound(Vector value) noexcept {
+			return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		}
+		inline Vector Pow2(Vector exponent) noexcept {
+			const Vector clampedExponent =
+				_mm256_min_ps(_mm256_max_ps(exponent, _mm256_set1_ps(-127.f)), _mm256_set1_ps(128.f));
+
+			return _mm256_castsi256_ps(_mm256_slli_epi32(
+				_mm256_add_epi32(_mm256_cvtps_epi32(clampedExponent), _mm256_set1_epi32(127)), 23));
+		}
+		inline Vector Frexp(Vector value, Vector& exponent) noexcept {
+			const __m256i bits = _mm256_castps_si256(value);
+
+			exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(
+				_mm256_srli_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7F800000)), 23), _mm256_set1_epi32(126)));
+
+			return _mm256_castsi256_ps(_mm256_or_si256(
+				_mm256_and_si256(bits, _mm256_set1_epi32(static_cast<int>(0x807FFFFF))), _mm256_set1_epi32(0x3F000000)));
+		}
+		inline float ReduceAdd(Vector value) noexcept {
+			return SSE2::ReduceAdd(_mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+		}
+		inline Vector LoadBFloat16(const std::uint16_t* pointer) noexcept {
+			const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pointer));
+
+			return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(value), 16));
+		}
+		inline void StoreBFloat16(std::uint16_t* pointer, Vector value) noexcept {
+			const __m256i bits = _mm256_castps_si256(value);
+			const __m256i high = _mm256_srli_epi32(bits, 16);
+			const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(bits, _mm256_set1_epi32(0x7FFF)),
+				_mm256_and_si256(high, _mm256_set1_epi32(1))), 16);
+			const __m256i result = _mm256_blendv_epi8(rounded, _mm256_or_si256(high, _mm256_set1_epi32(0x40)),
+				_mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q)));
+			const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pointer), _mm256_castsi256_si128(packed));
+		}
+		inline Vector LoadFloat16(const std::uint16_t* pointer) noexcept {
+			return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pointer)));
+		}
+		inline void StoreFloat16(std::uint16_t* pointer, Vector value) noexcept {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pointer), _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		using IntVector = __m256i;
+		constexpr std::size_t Int8Width = 16;
+
+		inline IntVector ZeroInt32() noexcept { return _mm256_setzero_si256(); }
+		inline IntVector MultiplyAddInt8(IntVector sum, const std::int8_t* x, const std::int8_t* y) noexcept {
+			const __m256i xWords = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)));
+			const __m256i yWords = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y)));
+
+			return _mm256_add_epi32(sum, _mm256_madd_epi16(xWords, yWords));
+		}
+		inline std::int32_t ReduceAddInt32(IntVector value) noexcept {
+			return SSE2::ReduceAddInt32(_mm_add_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1)));
+		}
+
+		inline void TransposeTile(const float* x, std::size_t ldx, float* y, std::size_t ldy) noexcept {
+			Vector rows[TransposeTileSize], pairs[TransposeTileSize], quads[TransposeTileSize];
+
+			for (std::size_t i = 0; i < TransposeTileSize; ++i) {
+				rows[i] = Load(x + i * ldx);
+			}
+			for (std::size_t i = 0; i < TransposeTileSize; i += 2) {
+				pairs[i] = _mm256_unpacklo_ps(rows[i], rows[i + 1]);
+				pairs[i + 1] = _mm256_unpackhi_ps(rows[i], rows[i + 1]);
+			}
+			for (std::size_t i = 0; i < TransposeTileSize; i += 4) {
+				quads[i] = _mm256_shuffle_ps(pairs[i], pairs[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+				quads[i + 1] = _mm256_shuffle_ps(pairs[i], pairs[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+				quads[i + 2] = _mm256_shuffle_ps(pairs[i + 1], pairs[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+				quads[i + 3] = _mm256_shuffle_ps(pairs[i + 1], pairs[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+			}
+			for (std::size_t i = 0; i < 4; ++i) {
+				Store(y + i * ldy, _mm256_permute2f128_ps(quads[i], quads[i + 4], 0x20));
+				Store(y + (i + 4) * ldy, _mm256_permute2f128_ps(quads[i], quads[i + 4], 0x31));
+			}
+		}
+
+#include "VectorKernel.inl"
+	}
+#	if defined(__clang__)
+#		pragma clang attribute pop
+#	elif defined(__GNUC__)
+#		pragma GCC pop_options
+#	endif
+
+#	if defined(__clang__)
+#		pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#	elif defined(__GNUC__)
+#		pragma GCC push_options
+#		pragma GCC target("avx512f")
+#	endif
+	namespace AVX512 {
+		using Vector = __m512;
+		constexpr std::size_t Width = 16;
+
+		inline Vector Load(const float* pointer) noexcept { return _mm512_loadu_ps(pointer); }
+		inline void Store(float* pointer, Vector value) noexcept { _mm512_storeu_ps(pointer, value); }
+		inline Vector Broadcast(float value) noexcept { return _mm512_set1_ps(value); }
+		inline Vector VAdd(Vector lhs, Vector rhs) noexcept { return _mm512_add_ps(lhs, rhs); }
+		inline Vector VSubtract(Vector lhs, Vector rhs) noexcept { return _mm512_sub_ps(lhs, rhs); }
+		inline Vector VMultiply(Vector lhs, Vector rhs) noexcept { return _mm512_mul_ps(lhs, rhs); }
+		inline Vector VMultiplyAdd(Vector lhs, Vector rhs, Vector addend) noexcept { return _mm512_fmadd_ps(lhs, rhs, addend); }
+		inline Vector VDivide(Vector lhs, Vector rhs) noexcept { return _mm512_div_ps(lhs, rhs); }
+		inline Vector VMax(Vector lhs, Vector rhs) noexcept { return _mm512_max_ps(lhs, rhs); }
+		inline Vector SelectNonNegative(Vector value, Vector ifTrue, Vector ifFalse) noexcept {
+			return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_GE_OQ), ifFalse, ifTrue);
+		}
+		inline Vector VRound(Vector value) noexcept {
+			return _mm512_roundscale_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		}
+		inline Vector Pow2(Vector exponent) noexcept {
+			const Vector clampedExponent =
+				_mm512_min_ps(_mm512_max_ps(exponent, _mm512_set1_ps(-127.f)), _mm512_set1_ps(128.f));
+
+			return _mm512_castsi512_ps(_mm512_slli_epi32(
+				_mm512_add_epi32(_mm512_cvtps_epi32(clampedExponent), _mm512_set1_epi32(127)), 23));
+		}
+		inline Vector Frexp(Vector value, Vector& exponent) noexcept {
+			const __m512i bits = _mm512_castps_si512(value);
+
+			exponent = _mm512_cvtepi32_ps(_mm512_sub_epi32(
+				_mm512_srli_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x7F800000)), 23), _mm512_set1_epi32(126)));
+
+			return _mm512_castsi512_ps(_mm512_or_si512(
+				_mm512_and_si512(bits, _mm512_set1_epi32(static_cast<int>(0x807FFFFF))), _mm512_set1_epi32(0x3F000000)));
+		}
+		inline float ReduceAdd(Vector value) noexcept {
+			return _mm512_reduce_add_ps(value);
+		}
+		inline Vector LoadBFloat16(const std::uint16_t* pointer) noexcept {
+			const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pointer));
+
+			return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(value), 16));
+		}
+		inline void StoreBFloat16(std::uint16_t* pointer, Vector value) noexcept {
+			const __m512i bits = _mm512_castps_si512(value);
+			const __m512i high = _mm512_srli_epi32(bits, 16);
+			const __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(bits, _mm512_set1_epi32(0x7FFF)),
+				_mm512_and_si512(high, _mm512_set1_epi32(1))), 16);
+			const __m512i result = _mm512_mask_or_epi32(rounded, _mm512_cmp_ps_mask(value, value, _CMP_UNORD_Q),
+				high, _mm512_set1_epi32(0x40));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pointer), _mm512_cvtepi32_epi16(result));
+		}
+		inline Vector LoadFloat16(const std::uint16_t* pointer) noexcept {
+			return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pointer)));
+		}
+		inline void StoreFloat16(std::uint16_t* pointer, Vector value) noexcept {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pointer), _mm512_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+		}
+
+		using AVX2::IntVector;
+		using AVX2::Int8Width;
+		using AVX2::ZeroInt32;
+		using AVX2::MultiplyAddInt8;
+		using AVX2::ReduceAddInt32;
+		using AVX2::TransposeTile;
+
+#include "VectorKernel.inl"
+	}
+#	if defined(__clang__)
+#		pragma clang attribute pop
+#	elif defined(__GNUC__)
+#		pragma GCC pop_options
+#	endif
+#endif
+
+	struct VectorKernelTable final {
+		SimdLevel Level;
+		void (*Add)(std::size_t, const float*, float*) noexcept;
+		void (*Subtract)(std::size_t, const float*, float*) noexcept;
+		void (*Multiply)(std::size_t, const float*, float*) noexcept;
+		void (*Divide)(std::size_t, const float*, float*) noexcept;
+		void (*Max)(std::size_t, const float*, float*) noexcept;
+		void (*Scale)(std::size_t, float, float*) noexcept;
+		void (*Axpy)(std::size_t, float, const float*, float*) noexcept;
+		void (*AddScalar)(std::size_t, float, float*) noexcept;
+		void (*ReLU)(std::size_t, float, float*) noexcept;
+		void (*ReLUDerivative)(std::size_t, float, float*) noexcept;
+		float (*Sum)(std::size_t, const float*) noexcept;
+		float (*SquaredDistance)(std::size_t, const float*, const float*) noexcept;
+		float (*Dot)(std::size_t, const float*, const float*) noexcept;
+		void (*ToBFloat16)(std::size_t, const float*, std::uint16_t*) noexcept;
+		void (*FromBFloat16)(std::size_t, const std::uint16_t*, float*) noexcept;
+		void (*ToFloat16)(std::size_t, const float*, std::uint16_t*) noexcept;
+		void (*FromFloat16)(std::size_t, const std::uint16_t*, float*) noexcept;
+		std::int32_t (*DotInt8)(std::size_t, const std::int8_t*, const std::int8_t*) noexcept;
+		void (*Transpose)(std::size_t, std::size_t, const float*, std::size_t, float*, std::size_t) noexcept;
+		void (*TransposeInPlace)(std::size_t, float*, std::size_t) noexcept;
+		void (*GemmMicroKernel[GemmMicroTileSizes.size()])(std::size_t, float, const float*, const float*,
+			float*, std::size_t) noexcept;
+		void (*Exp[2])(std::size_t, float*) noexcept;
+		void (*Log[2])(std::size_t, float*) noexcept;
+		void (*Tanh[2])(std::size_t, float*) noexcept;
+		void (*Sigmoid[2])(std::size_t, float*) noexcept;
+		void (*TanhDerivative[2])(std::size_t, float*) noexcept;
+		void (*SigmoidDerivative[2])(std::size_t, float*) noexcept;
+	};
+
+#define SAM_GEMM_MICRO_KERNEL(level, index) \
+	level::GemmMicroKernel<GemmMicroTileSizes[index].first, GemmMicroTileSizes[index].second>
+#define SAM_VECTOR_KERNEL_TABLE(level) VectorKernelTable{ SimdLevel::level, \
+	level::Add, level::Subtract, level::Multiply, level::Divide, level::Max, level::Scale, level::Axpy, \
+	level::AddScalar, level::ReLU, level::ReLUDerivative, level::Sum, level::SquaredDistance, level::Dot, \
+	level::ToBFloat16, level::FromBFloat16, level::ToFloat16, level::FromFloat16, level::DotInt8, level::Transpose, level::TransposeInPlace, \
+	{ SAM_GEMM_MICRO_KERNEL(level, 0), SAM_GEMM_MICRO_KERNEL(level, 1), SAM_GEMM_MICRO_KERNEL(level, 2), \
+	SAM_GEMM_MICRO_KERNEL(level, 3), SAM_GEMM_MICRO_KERNEL(level, 4) }, \
+	{ level::Exp<false>, level::Exp<true> }, { level::Log<false>, level::Log<true> }, \
+	{ level::Tanh<false>, level::Tanh<true> }, { level::Sigmoid<false>, level::Sigmoid<true> }, \
+	{ level::TanhDerivative<false>, level::TanhDerivative<true> }, \
+	{ level::SigmoidDerivative<false>, level::SigmoidDerivative<true> } }
+
+#ifdef SAM_X86
+	void Cpuid(unsigned int leaf, unsigned int (&registers)[4]) noexcept {
+#	ifdef _MSC_VER
+		__cpuidex(reinterpret_cast<int*>(registers), static_cast<int>(leaf), 0);
+#	else
+		__cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+#	endif
+	}
+#endif
+
+	SimdLevel DetectSimdLevel() noexcept {
+#ifdef SAM_X86
+		unsigned int registers[4] = {};
+		const auto cpuid = [&registers](unsigned int leaf) {
+			Cpuid(leaf, registers);
+		};
+		const auto xgetbv = []() -> unsigned long long {
+#	ifdef _MSC_VER
+			return _xgetbv(0);
+#	else
+			unsigned int eax, edx;
+			__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+			return (static_cast<unsigned long long>(edx) << 32) | eax;
+#	endif
+		};
+
+		cpuid(0);
+		const unsigned int maxLeaf = registers[0];
+
+		cpuid(1);
+		const bool hasSSE2 = (registers[3] & (1u << 26)) != 0;
+		const bool hasOSXSave = (registers[2] & (1u << 27)) != 0;
+		const bool hasAVX = (registers[2] & (1u << 28)) != 0;
+		const bool hasFMA = (registers[2] & (1u << 12)) != 0;
+		const bool hasF16C = (registers[2] & (1u << 29)) != 0;
+
+		if (!hasSSE2) return SimdLevel::Scalar;
+		if (!hasOSXSave || !hasAVX || maxLeaf < 7) return SimdLevel::SSE2;
+
+		const unsigned long long xcr0 = xgetbv();
+		if ((xcr0 & 0x6) != 0x6) return SimdLevel::SSE2;
+
+		cpuid(7);
+		const bool hasAVX2 = (registers[1] & (1u << 5)) != 0;
+		const bool hasAVX512F = (registers[1] & (1u << 16)) != 0;
+
+		if (hasAVX512F && (xcr0 & 0xE6) == 0xE6) return SimdLevel::AVX512;
+		if (hasAVX2 && hasFMA && hasF16C) return SimdLevel::AVX2;
+
+		return SimdLevel::SSE2;
+#else
+		return SimdLevel::Scalar;
+#endif
+	}
+
+	const VectorKernelTable& GetVectorKernelTable() noexcept {
+		static const VectorKernelTable table = []() noexcept {
+			switch (DetectSimdLevel()) {
+#ifdef SAM_X86
+			case SimdLevel::AVX512:
+				return SAM_VECTOR_KERNEL_TABLE(AVX512);
+
+			case SimdLevel::AVX2:
+				return SAM_VECTOR_KERNEL_TABLE(AVX2);
+
+			case SimdLevel::SSE2:
+				return SAM_VECTOR_KERNEL_TABLE(SSE2);
+#endif
+
+			default:
+				return SAM_VECTOR_KERNEL_TABLE(Scalar);
+			}
+		}();
+
+		return table;
+	}
+
+	std::atomic<MathAccuracy> g_MathAccuracy = MathAccuracy::Precise;
+
+	std::size_t GetMathAccuracyIndex() noexcept {
+		return static_cast<std::size_t>(g_MathAccuracy.load(std::memory_order_relaxed));
+	}
+}
+
+SimdLevel GetSimdLevel() noexcept {
+	return GetVectorKernelTable().Level;
+}
+std::string GetProcessorName() {
+	std::string result;
+
+#ifdef SAM_X86
+	unsigned int registers[4] = {};
+
+	Cpuid(0x80000000u, registers);
+
+	if (registers[0] >= 0x80000004u) {
+		for (unsigned int leaf = 0x80000002u; leaf <= 0x80000004u; ++leaf) {
+			Cpuid(leaf, registers);
+			result.append(reinterpret_cast<const char*>(registers), sizeof(registers));
+		}
+	}
+#endif
+
+	result.erase(std::find(result.begin(), result.end(), '\0'), result.end());
+	result.erase(0, result.find_first_not_of(' '));
+	result.erase(result.find_last_not_of(' ') + 1);
+
+	return result.empty() ? "Unknown" : result;
+}
+MathAccuracy GetMathAccuracy() noexcept {
+	return g_MathAccuracy.load(std::memory_order_relaxed);
+}
+void SetMathAccuracy(MathAccuracy newMathAccuracy) noexcept {
+	g_MathAccuracy.store(newMathAccuracy, std::memory_order_relaxed);
+}
+
+void AddKernel(std::size_t n, const float* x, float* y) noexcept {
+	GetVectorKernelTable().Add(n, x, y);
+}
+void SubtractKernel(std::size_t n, const float* x, float* y) noexcept {
+	GetVectorKernelTable().Subtract(n, x, y);
+}
+void MultiplyKernel(std::size_t n, const float* x, float* y) noexcept {
+	GetVectorKernelTable().Multiply(n, x, y);
+}
+void DivideKernel(std::size_t n, const float* x, float* y) noexcept {
+	GetVectorKernelTable().Divide(n, x, y);
+}
+void MaxKernel(std::size_t n, const float* x, float* y) noexcept {
+	GetVectorKernelTable().Max(n, x, y);
+}
+void ScaleKernel(std::size_t n, float alpha, float* y) noexcept {
+	GetVectorKernelTable().Scale(n, alpha, y);
+}
+void AxpyKernel(std::size_t n, float alpha, const float* x, float* y) noexcept {
+	GetVectorKernelTable().Axpy(n, alpha, x, y);
+}
+void AddScalarKernel(std::size_t n, float alpha, float* y) noexcept {
+	GetVectorKernelTable().AddScalar(n, alpha, y);
+}
+void ReLUKernel(std::size_t n, float slope, float* y) noexcept {
+	GetVectorKernelTable().ReLU(n, slope, y);
+}
+void ReLUDerivativeKernel(std::size_t n, float slope, float* y) noexcept {
+	GetVectorKernelTable().ReLUDerivative(n, slope, y);
+}
+float SumKernel(std::size_t n, const float* x) noexcept {
+	return GetVectorKernelTable().Sum(n, x);
+}
+float SquaredDistanceKernel(std::size_t n, const float* x, const float* y) noexcept {
+	return GetVectorKernelTable().SquaredDistance(n, x, y);
+}
+float DotKernel(std::size_t n, const float* x, const float* y) noexcept {
+	return GetVectorKernelTable().Dot(n, x, y);
+}
+void FloatToBFloat16Kernel(std::size_t n, const float* x, std::uint16_t* y) noexcept {
+	GetVectorKernelTable().ToBFloat16(n, x, y);
+}
+void BFloat16ToFloatKernel(std::size_t n, const std::uint16_t* x, float* y) noexcept {
+	GetVectorKernelTable().FromBFloat16(n, x, y);
+}
+void FloatToFloat16Kernel(std::size_t n, const float* x, std::uint16_t* y) noexcept {
+	GetVectorKernelTable().ToFloat16(n, x, y);
+}
+void Float16ToFloatKernel(std::size_t n, const std::uint16_t* x, float* y) noexcept {
+	GetVectorKernelTable().FromFloat16(n, x, y);
+}
+std::int32_t DotInt8Kernel(std::size_t n, const std::int8_t* x, const std::int8_t* y) noexcept {
+	return GetVectorKernelTable().DotInt8(n, x, y);
+}
+void TransposeKernel(std::size_t m, std::size_t n, const float* x, std::size_t ldx, float* y, std::size_t ldy) noexcept {
+	GetVectorKernelTable().Transpose(m, n, x, ldx, y, ldy);
+}
+void TransposeInPlaceKernel(std::size_t n, float* y, std::size_t ldy) noexcept {
+	GetVectorKernelTable().TransposeInPlace(n, y, ldy);
+}
+void GemmMicroKernel(std::size_t microTileIndex, std::size_t kc, float alpha, const float* packedA, const float* packedB,
+	float* c, std::size_t ldc) noexcept {
+	GetVectorKernelTable().GemmMicroKernel[microTileIndex](kc, alpha, packedA, packedB, c, ldc);
+}
+void ExpKernel(std::size_t n, float* y) noexcept {
+	GetVectorKernelTable().Exp[GetMathAccuracyIndex()](n, y);
+}
+void LogKernel(std::size_t n, float* y) noexcept {
+	GetVectorKernelTable().Log[GetMathAccuracyIndex()](n, y);
+}
+void TanhKernel(std::size_t n, float* y) noexcept {
+	GetVectorKernelTable().Tanh[GetMathAccuracyIndex()](n, y);
+}
+void SigmoidKernel(std::size_t n, float* y) noexcept {
+	GetVectorKernelTable().Sigmoid[GetMathAccuracyIndex()](n, y);
+}
+void TanhDerivativeKernel(std::size_t n, float* y) noexcept {
+	GetVectorKernelTable().TanhDerivative[GetMathAccuracyIndex()](n, y);
+}
+void SigmoidDerivativeKernel(std::size_t n, float* y) noexcept {
+	GetVectorKernelTable().SigmoidDerivative[GetMathAccuracyIndex()](n, y);
+}
+
+void AddKernel(std::size_t n, const double* x, double* y) noexcept {
+	for (std::size_t i = 0; i < n; ++i) {
+		y[i] += x[i];
+	}
+}
+void SubtractKernel(std::size_t n, const double* x, double* y) noexcept {
+	for (std::size_t i = 0; i < n; ++i) {
+		y[i] -= x[i];
+	}
+}
+void MultiplyKernel(std::size_t n, const double* x, double* y) noexcept {
+	for (std::size_t i = 0; i < n; ++i) {
+		y[i] *= x[i];
+	}
+}
+void ScaleKernel(std::size_t n, double alpha, double* y) noexcept {
+	for (std::size_t i = 0; i < n; ++i) {
+		y[i] *= alpha;
+	}
+}
+void AxpyKernel(std::size_t n, double alpha, const double* x, double* y) noexcept {
+	for (std::size_t i = 0; i < n; ++i) {
+		y[i] += alpha * x[i];
+	}
+}
+void AddScalarKernel(std::size_t n, double alpha, double* y) noexcept {
+	for (std::size_t i = 0; i < n; ++i) {
+		y[i] += alpha;
+	}
+}
+double SumKernel(std::size_t n, const double* x) noexcept {
+	double sum = 0.;
+
+	for (std::size_t i = 0; i < n; ++i) {
+		sum += x[i];
+	}
+
+	return sum;
+}
+void TransposeKernel(std::size_t m, std::size_t n, const double* x, std::size_t ldx, double* y, std::size_t ldy) noexcept {
+	for (std::size_t ib = 0; ib < m; ib += TransposeTileSize) {
+		const std::size_t iEnd = std::min(ib + TransposeTileSize, m);
+
+		for (std::size_t jb = 0; jb < n; jb += TransposeTileSize) {
+			const std::size_t jEnd = std::min(jb + TransposeTileSize, n);
+
+			for (std::size_t i = ib; i < iEnd; ++i) {
+				for (std::size_t j = jb; j < jEnd; ++j) {
+					y[j * ldy + i] = x[i * ldx + j];
+				}
+			}
+		}
+	}
+}
+void TransposeInPlaceKernel(std::size_t n, double* y, std::size_t ldy) noexcept {
+	for (std::size_t ib = 0; ib < n; ib += TransposeTileSize) {
+		const std::size_t iEnd = std::min(ib + TransposeTileSize, n);
+
+		for (std::size_t jb = ib; jb < n; jb += TransposeTileSize) {
+			const std::size_t jEnd = std::min(jb + TransposeTileSize, n);
+
+			for (std::size_t i = ib; i < iEnd; ++i) {
+				for (std::size_t j = std::max(jb, i + 1); j < jEnd; ++j) {
+					std::swap(y[i * ldy + j], y[j * ldy + i]);
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
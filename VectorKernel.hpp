@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+enum class SimdLevel {
+	Scalar,
+	SSE2,
+	AVX2,
+	AVX512,
+};
+
+enum class MathAccuracy {
+	Precise,
+	Fast,
+};
+
+inline constexpr std::array<std::pair<std::size_t, std::size_t>, 5> GemmMicroTileSizes = {{
+	{ 4, 8 }, { 4, 16 }, { 6, 16 }, { 8, 8 }, { 8, 16 },
+}};
+
+SimdLevel GetSimdLevel() noexcept;
+std::string GetProcessorName();
+MathAccuracy GetMathAccuracy() noexcept;
+void SetMathAccuracy(MathAccuracy newMathAccuracy) noexcept;
+
+void AddKernel(std::size_t n, const float* x, float* y) noexcept;
+void SubtractKernel(std::size_t n, const float* x, float* y) noexcept;
+void MultiplyKernel(std::size_t n, const float* x, float* y) noexcept;
+void DivideKernel(std::size_t n, const float* x, float* y) noexcept;
+void MaxKernel(std::size_t n, const float* x, float* y) noexcept;
+void ScaleKernel(std::size_t n, float alpha, float* y) noexcept;
+void AxpyKernel(std::size_t n, float alpha, const float* x, float* y) noexcept;
+void AddScalarKernel(std::size_t n, float alpha, float* y) noexcept;
+void ReLUKernel(std::size_t n, float slope, float* y) noexcept;
+void ReLUDerivativeKernel(std::size_t n, float slope, float* y) noexcept;
+float SumKernel(std::size_t n, const float* x) noexcept;
+float SquaredDistanceKernel(std::size_t n, const float* x, const float* y) noexcept;
+float DotKernel(std::size_t n, const float* x, const float* y) noexcept;
+void FloatToBFloat16Kernel(std::size_t n, const float* x, std::uint16_t* y) noexcept;
+void BFloat16ToFloatKernel(std::size_t n, const std::uint16_t* x, float* y) noexcept;
+void FloatToFloat16Kernel(std::size_t n, const float* x, std::uint16_t* y) noexcept;
+void Float16ToFloatKernel(std::size_t n, const std::uint16_t* x, float* y) noexcept;
+std::int32_t DotInt8Kernel(std::size_t n, const std::int8_t* x, const std::int8_t* y) noexcept;
+void TransposeKernel(std::size_t m, std::size_t n, const float* x, std::size_t ldx, float* y, std::size_t ldy) noexcept;
+void TransposeInPlaceKernel(std::size_t n, float* y, std::size_t ldy) noexcept;
+void GemmMicroKernel(std::size_t microTileIndex, std::size_t kc, float alpha, const float* packedA, const float* packedB,
+	float* c, std::size_t ldc) noexcept;
+void ExpKernel(std::size_t n, float* y) noexcept;
+void LogKernel(std::size_t n, float* y) noexcept;
+void TanhKernel(std::size_t n, float* y) noexcept;
+void SigmoidKernel(std::size_t n, float* y) noexcept;
+void TanhDerivativeKernel(std::size_t n, float* y) noexcept;
+void SigmoidDerivativeKernel(std::size_t n, float* y) noexcept;
+
+void AddKernel(std::size_t n, const double* x, double* y) noexcept;
+void SubtractKernel(std::size_t n, const double* x, double* y) noexcept;
+void MultiplyKernel(std::size_t n, const double* x, double* y) noexcept;
+void ScaleKernel(std::size_t n, double alpha, double* y) noexcept;
+void AxpyKernel(std::size_t n, double alpha, const double* x, double* y) noexcept;
+void AddScalarKernel(std::size_t n, double alpha, double* y) noexcept;
+double SumKernel(std::size_t n, const double* x) noexcept;
+void TransposeKernel(std::size_t m, std::size_t n, const double* x, std::size_t ldx, double* y, std::size_t ldy) noexcept;
+void TransposeInPlaceKernel(std::size_t n, double* y, std::size_t ldy) noexcept;
\ No newline at end of file
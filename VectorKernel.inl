@@ -0,0 +1,515 @@
+void Add(std::size_t n, const float* x, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VAdd(Load(y + i), Load(x + i)));
+	}
+	for (; i < n; ++i) {
+		y[i] += x[i];
+	}
+}
+void Subtract(std::size_t n, const float* x, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VSubtract(Load(y + i), Load(x + i)));
+	}
+	for (; i < n; ++i) {
+		y[i] -= x[i];
+	}
+}
+void Multiply(std::size_t n, const float* x, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VMultiply(Load(y + i), Load(x + i)));
+	}
+	for (; i < n; ++i) {
+		y[i] *= x[i];
+	}
+}
+void Divide(std::size_t n, const float* x, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VDivide(Load(y + i), Load(x + i)));
+	}
+	for (; i < n; ++i) {
+		y[i] /= x[i];
+	}
+}
+void Max(std::size_t n, const float* x, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VMax(Load(y + i), Load(x + i)));
+	}
+	for (; i < n; ++i) {
+		y[i] = std::max(y[i], x[i]);
+	}
+}
+void Scale(std::size_t n, float alpha, float* y) noexcept {
+	const Vector alphaVector = Broadcast(alpha);
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VMultiply(Load(y + i), alphaVector));
+	}
+	for (; i < n; ++i) {
+		y[i] *= alpha;
+	}
+}
+void Axpy(std::size_t n, float alpha, const float* x, float* y) noexcept {
+	const Vector alphaVector = Broadcast(alpha);
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VAdd(Load(y + i), VMultiply(alphaVector, Load(x + i))));
+	}
+	for (; i < n; ++i) {
+		y[i] += alpha * x[i];
+	}
+}
+void AddScalar(std::size_t n, float alpha, float* y) noexcept {
+	const Vector alphaVector = Broadcast(alpha);
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, VAdd(Load(y + i), alphaVector));
+	}
+	for (; i < n; ++i) {
+		y[i] += alpha;
+	}
+}
+void ReLU(std::size_t n, float slope, float* y) noexcept {
+	const Vector slopeVector = Broadcast(slope);
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		const Vector value = Load(y + i);
+
+		Store(y + i, VMax(value, VMultiply(value, slopeVector)));
+	}
+	for (; i < n; ++i) {
+		y[i] = std::max(y[i], slope * y[i]);
+	}
+}
+void ReLUDerivative(std::size_t n, float slope, float* y) noexcept {
+	const Vector oneVector = Broadcast(1.f), slopeVector = Broadcast(slope);
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, SelectNonNegative(Load(y + i), oneVector, slopeVector));
+	}
+	for (; i < n; ++i) {
+		y[i] = y[i] >= 0.f ? 1.f : slope;
+	}
+}
+float Sum(std::size_t n, const float* x) noexcept {
+	Vector sumVector = Broadcast(0.f);
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		sumVector = VAdd(sumVector, Load(x + i));
+	}
+
+	float sum = ReduceAdd(sumVector);
+
+	for (; i < n; ++i) {
+		sum += x[i];
+	}
+
+	return sum;
+}
+float SquaredDistance(std::size_t n, const float* x, const float* y) noexcept {
+	Vector sumVector = Broadcast(0.f);
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		const Vector difference = VSubtract(Load(x + i), Load(y + i));
+
+		sumVector = VAdd(sumVector, VMultiply(difference, difference));
+	}
+
+	float sum = ReduceAdd(sumVector);
+
+	for (; i < n; ++i) {
+		const float difference = x[i] - y[i];
+
+		sum += difference * difference;
+	}
+
+	return sum;
+}
+float Dot(std::size_t n, const float* x, const float* y) noexcept {
+	Vector sumVector0 = Broadcast(0.f), sumVector1 = Broadcast(0.f);
+	std::size_t i = 0;
+
+	for (; i + 2 * Width <= n; i += 2 * Width) {
+		sumVector0 = VAdd(sumVector0, VMultiply(Load(x + i), Load(y + i)));
+		sumVector1 = VAdd(sumVector1, VMultiply(Load(x + i + Width), Load(y + i + Width)));
+	}
+	for (; i + Width <= n; i += Width) {
+		sumVector0 = VAdd(sumVector0, VMultiply(Load(x + i), Load(y + i)));
+	}
+
+	float sum = ReduceAdd(VAdd(sumVector0, sumVector1));
+
+	for (; i < n; ++i) {
+		sum += x[i] * y[i];
+	}
+
+	return sum;
+}
+void ToBFloat16(std::size_t n, const float* x, std::uint16_t* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		StoreBFloat16(y + i, Load(x + i));
+	}
+	for (; i < n; ++i) {
+		y[i] = FloatToBFloat16(x[i]);
+	}
+}
+void FromBFloat16(std::size_t n, const std::uint16_t* x, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, LoadBFloat16(x + i));
+	}
+	for (; i < n; ++i) {
+		y[i] = BFloat16ToFloat(x[i]);
+	}
+}
+void ToFloat16(std::size_t n, const float* x, std::uint16_t* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		StoreFloat16(y + i, Load(x + i));
+	}
+	for (; i < n; ++i) {
+		y[i] = FloatToFloat16(x[i]);
+	}
+}
+void FromFloat16(std::size_t n, const std::uint16_t* x, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, LoadFloat16(x + i));
+	}
+	for (; i < n; ++i) {
+		y[i] = Float16ToFloat(x[i]);
+	}
+}
+std::int32_t DotInt8(std::size_t n, const std::int8_t* x, const std::int8_t* y) noexcept {
+	IntVector sumVector = ZeroInt32();
+	std::size_t i = 0;
+
+	for (; i + Int8Width <= n; i += Int8Width) {
+		sumVector = MultiplyAddInt8(sumVector, x + i, y + i);
+	}
+
+	std::int32_t sum = ReduceAddInt32(sumVector);
+
+	for (; i < n; ++i) {
+		sum += x[i] * y[i];
+	}
+
+	return sum;
+}
+void Transpose(std::size_t m, std::size_t n, const float* x, std::size_t ldx, float* y, std::size_t ldy) noexcept {
+	constexpr std::size_t blockSize = 8 * TransposeTileSize;
+
+	for (std::size_t ib = 0; ib < m; ib += blockSize) {
+		const std::size_t iEnd = std::min(ib + blockSize, m);
+
+		for (std::size_t jb = 0; jb < n; jb += blockSize) {
+			const std::size_t jEnd = std::min(jb + blockSize, n);
+			std::size_t i = ib;
+
+			for (; i + TransposeTileSize <= iEnd; i += TransposeTileSize) {
+				std::size_t j = jb;
+
+				for (; j + TransposeTileSize <= jEnd; j += TransposeTileSize) {
+					TransposeTile(x + i * ldx + j, ldx, y + j * ldy + i, ldy);
+				}
+				for (; j < jEnd; ++j) {
+					for (std::size_t k = i; k < i + TransposeTileSize; ++k) {
+						y[j * ldy + k] = x[k * ldx + j];
+					}
+				}
+			}
+			for (; i < iEnd; ++i) {
+				for (std::size_t j = jb; j < jEnd; ++j) {
+					y[j * ldy + i] = x[i * ldx + j];
+				}
+			}
+		}
+	}
+}
+void TransposeInPlace(std::size_t n, float* y, std::size_t ldy) noexcept {
+	float tile[TransposeTileSize * TransposeTileSize];
+	const auto saveTile = [&tile, ldy](const float* source) noexcept {
+		for (std::size_t k = 0; k < TransposeTileSize; ++k) {
+			std::copy_n(source + k * ldy, TransposeTileSize, tile + k * TransposeTileSize);
+		}
+	};
+	std::size_t i = 0;
+
+	for (; i + TransposeTileSize <= n; i += TransposeTileSize) {
+		float* const diagonal = y + i * ldy + i;
+
+		saveTile(diagonal);
+		TransposeTile(tile, TransposeTileSize, diagonal, ldy);
+
+		std::size_t j = i + TransposeTileSize;
+
+		for (; j + TransposeTileSize <= n; j += TransposeTileSize) {
+			float* const upper = y + i * ldy + j;
+			float* const lower = y + j * ldy + i;
+
+			saveTile(upper);
+			TransposeTile(lower, ldy, upper, ldy);
+			TransposeTile(tile, TransposeTileSize, lower, ldy);
+		}
+		for (std::size_t k = i; k < i + TransposeTileSize; ++k) {
+			for (std::size_t l = j; l < n; ++l) {
+				std::swap(y[k * ldy + l], y[l * ldy + k]);
+			}
+		}
+	}
+	for (; i < n; ++i) {
+		for (std::size_t j = i + 1; j < n; ++j) {
+			std::swap(y[i * ldy + j], y[j * ldy + i]);
+		}
+	}
+}
+template<Vector(*Function)(Vector) noexcept>
+void MapVectors(std::size_t n, float* y) noexcept {
+	std::size_t i = 0;
+
+	for (; i + Width <= n; i += Width) {
+		Store(y + i, Function(Load(y + i)));
+	}
+	if (i < n) {
+		float tail[Width] = {};
+
+		std::copy_n(y + i, n - i, tail);
+		Store(tail, Function(Load(tail)));
+		std::copy_n(tail, n - i, y + i);
+	}
+}
+
+template<bool IsFast>
+Vector VExp(Vector x) noexcept {
+	const Vector exponent = VRound(VMultiply(x, Broadcast(1.44269504088896341f)));
+	const Vector r = VAdd(VSubtract(x, VMultiply(exponent, Broadcast(0.693359375f))),
+		VMultiply(exponent, Broadcast(2.12194440e-4f)));
+	Vector polynomial;
+
+	if constexpr (IsFast) {
+		polynomial = VAdd(VMultiply(Broadcast(1.f / 24), r), Broadcast(1.f / 6));
+		polynomial = VAdd(VMultiply(polynomial, r), Broadcast(0.5f));
+	} else {
+		polynomial = VAdd(VMultiply(Broadcast(1.9875691500e-4f), r), Broadcast(1.3981999507e-3f));
+		polynomial = VAdd(VMultiply(polynomial, r), Broadcast(8.3334519073e-3f));
+		polynomial = VAdd(VMultiply(polynomial, r), Broadcast(4.1665795894e-2f));
+		polynomial = VAdd(VMultiply(polynomial, r), Broadcast(1.6666665459e-1f));
+		polynomial = VAdd(VMultiply(polynomial, r), Broadcast(5.0000001201e-1f));
+	}
+
+	const Vector halfExponent = VRound(VMultiply(exponent, Broadcast(0.5f)));
+	const Vector result = VMultiply(VMultiply(VAdd(VAdd(VMultiply(polynomial, VMultiply(r, r)), r), Broadcast(1.f)),
+		Pow2(halfExponent)), Pow2(VSubtract(exponent, halfExponent)));
+	const Vector saturated = SelectNonNegative(VSubtract(x, Broadcast(88.7228391f)),
+		Broadcast(std::numeric_limits<float>::infinity()), result);
+
+	return SelectNonNegative(VSubtract(Broadcast(-103.972077f), x), Broadcast(0.f), saturated);
+}
+template<bool IsFast>
+Vector VLog(Vector x) noexcept {
+	const Vector normalized = VSubtract(x, Broadcast(std::numeric_limits<float>::min()));
+	Vector exponent;
+	const Vector mantissa = Frexp(SelectNonNegative(normalized, x, VMultiply(x, Broadcast(8388608.f))), exponent);
+	const Vector infinite = VSubtract(exponent, Broadcast(129.f));
+
+	exponent = SelectNonNegative(normalized, exponent, VSubtract(exponent, Broadcast(23.f)));
+
+	const Vector shift = VSubtract(mantissa, Broadcast(0.707106781186547524f));
+
+	exponent = SelectNonNegative(shift, exponent, VSubtract(exponent, Broadcast(1.f)));
+
+	const Vector z = SelectNonNegative(shift, VSubtract(mantissa, Broadcast(1.f)),
+		VSubtract(VAdd(mantissa, mantissa), Broadcast(1.f)));
+	Vector result;
+
+	if constexpr (IsFast) {
+		const Vector s = VDivide(z, VAdd(z, Broadcast(2.f)));
+		const Vector s2 = VMultiply(s, s);
+
+		result = VMultiply(VAdd(s, s), VAdd(VMultiply(s2, Broadcast(1.f / 3)), Broadcast(1.f)));
+		result = VAdd(result, VMultiply(exponent, Broadcast(0.693147180559945f)));
+	} else {
+		const Vector z2 = VMultiply(z, z);
+		Vector polynomial = VAdd(VMultiply(Broadcast(7.0376836292e-2f), z), Broadcast(-1.1514610310e-1f));
+
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(1.1676998740e-1f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(-1.2420140846e-1f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(1.4249322787e-1f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(-1.6668057665e-1f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(2.0000714765e-1f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(-2.4999993993e-1f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(3.3333331174e-1f));
+
+		Vector y = VMultiply(VMultiply(polynomial, z), z2);
+
+		y = VAdd(y, VMultiply(exponent, Broadcast(-2.12194440e-4f)));
+		y = VSubtract(y, VMultiply(z2, Broadcast(0.5f)));
+		result = VAdd(VAdd(z, y), VMultiply(exponent, Broadcast(0.693359375f)));
+	}
+
+	const Vector zero = Broadcast(0.f);
+
+	result = SelectNonNegative(infinite, Broadcast(std::numeric_limits<float>::infinity()), result);
+	result = SelectNonNegative(VSubtract(zero, x), Broadcast(-std::numeric_limits<float>::infinity()), result);
+
+	return SelectNonNegative(x, result, Broadcast(std::numeric_limits<float>::quiet_NaN()));
+}
+template<bool IsFast>
+Vector VSigmoid(Vector x) noexcept {
+	const Vector one = Broadcast(1.f);
+
+	return VDivide(one, VAdd(one, VExp<IsFast>(VSubtract(Broadcast(0.f), x))));
+}
+template<bool IsFast>
+Vector VTanh(Vector x) noexcept {
+	const Vector one = Broadcast(1.f);
+	const Vector large = VSubtract(one, VDivide(Broadcast(2.f), VAdd(VExp<IsFast>(VAdd(x, x)), one)));
+
+	if constexpr (IsFast) {
+		return large;
+	} else {
+		const Vector z = VMultiply(x, x);
+		Vector polynomial = VAdd(VMultiply(Broadcast(-5.70498872745e-3f), z), Broadcast(2.06390887954e-2f));
+
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(-5.37397155531e-2f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(1.33314422036e-1f));
+		polynomial = VAdd(VMultiply(polynomial, z), Broadcast(-3.33332819422e-1f));
+
+		const Vector small = VAdd(x, VMultiply(VMultiply(x, z), polynomial));
+		const Vector magnitude = VMax(x, VSubtract(Broadcast(0.f), x));
+
+		return SelectNonNegative(VSubtract(magnitude, Broadcast(0.625f)), large, small);
+	}
+}
+
+template<bool IsFast>
+Vector VTanhDerivative(Vector x) noexcept {
+	const Vector magnitude = VMax(x, VSubtract(Broadcast(0.f), x));
+	const Vector value = VExp<IsFast>(VMultiply(magnitude, Broadcast(-2.f)));
+	const Vector denominator = VAdd(value, Broadcast(1.f));
+
+	return VDivide(VMultiply(value, Broadcast(4.f)), VMultiply(denominator, denominator));
+}
+template<bool IsFast>
+Vector VSigmoidDerivative(Vector x) noexcept {
+	const Vector value = VExp<IsFast>(VSubtract(Broadcast(0.f), VMax(x, VSubtract(Broadcast(0.f), x))));
+	const Vector denominator = VAdd(value, Broadcast(1.f));
+
+	return VDivide(value, VMultiply(denominator, denominator));
+}
+
+template<std::size_t MR, std::size_t NR>
+void GemmMicroKernel(std::size_t kc, float alpha, const float* packedA, const float* packedB,
+	float* c, std::size_t ldc) noexcept {
+	if constexpr (NR % Width == 0) {
+		constexpr std::size_t VectorCount = NR / Width;
+		Vector acc[MR][VectorCount];
+
+		SAM_UNROLL
+		for (std::size_t i = 0; i < MR; ++i) {
+			SAM_UNROLL
+			for (std::size_t j = 0; j < VectorCount; ++j) {
+				acc[i][j] = Broadcast(0.f);
+			}
+		}
+
+		for (std::size_t p = 0; p < kc; ++p) {
+			Vector b[VectorCount];
+
+			SAM_UNROLL
+			for (std::size_t j = 0; j < VectorCount; ++j) {
+				b[j] = Load(packedB + j * Width);
+			}
+
+			SAM_UNROLL
+			for (std::size_t i = 0; i < MR; ++i) {
+				const Vector a = Broadcast(packedA[i]);
+
+				SAM_UNROLL
+				for (std::size_t j = 0; j < VectorCount; ++j) {
+					acc[i][j] = VMultiplyAdd(a, b[j], acc[i][j]);
+				}
+			}
+
+			packedA += MR;
+			packedB += NR;
+		}
+
+		const Vector alphaVector = Broadcast(alpha);
+
+		SAM_UNROLL
+		for (std::size_t i = 0; i < MR; ++i) {
+			SAM_UNROLL
+			for (std::size_t j = 0; j < VectorCount; ++j) {
+				float* const cVector = c + i * ldc + j * Width;
+
+				Store(cVector, VMultiplyAdd(alphaVector, acc[i][j], Load(cVector)));
+			}
+		}
+	} else {
+		float acc[MR][NR] = {};
+
+		for (std::size_t p = 0; p < kc; ++p) {
+			for (std::size_t i = 0; i < MR; ++i) {
+				for (std::size_t j = 0; j < NR; ++j) {
+					acc[i][j] += packedA[i] * packedB[j];
+				}
+			}
+
+			packedA += MR;
+			packedB += NR;
+		}
+
+		for (std::size_t i = 0; i < MR; ++i) {
+			for (std::size_t j = 0; j < NR; ++j) {
+				c[i * ldc + j] += alpha * acc[i][j];
+			}
+		}
+	}
+}
+
+template<bool IsFast>
+void Exp(std::size_t n, float* y) noexcept {
+	MapVectors<VExp<IsFast>>(n, y);
+}
+template<bool IsFast>
+void Log(std::size_t n, float* y) noexcept {
+	MapVectors<VLog<IsFast>>(n, y);
+}
+template<bool IsFast>
+void Tanh(std::size_t n, float* y) noexcept {
+	MapVectors<VTanh<IsFast>>(n, y);
+}
+template<bool IsFast>
+void Sigmoid(std::size_t n, float* y) noexcept {
+	MapVectors<VSigmoid<IsFast>>(n, y);
+}
+template<bool IsFast>
+void TanhDerivative(std::size_t n, float* y) noexcept {
+	MapVectors<VTanhDerivative<IsFast>>(n, y);
+}
+template<bool IsFast>
+void SigmoidDerivative(std::size_t n, float* y) noexcept {
+	MapVectors<VSigmoidDerivative<IsFast>>(n, y);
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifdef _WIN32
+#include "PALFileSystem.hpp"
+
+#include "Application.hpp"
+
+#include <Windows.h>
+#include <ShlObj.h>
+
+std::filesystem::path PALGetUserDataDirectory() {
+	PWSTR localAppData = nullptr;
+	if (FAILED(SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &localAppData))) {
+		CoTaskMemFree(localAppData);
+
+		return {};
+	}
+
+	std::filesystem::path result(localAppData);
+	CoTaskMemFree(localAppData);
+
+	return result / SAM_APPNAME;
+}
+#endif
\ No newline at end of file
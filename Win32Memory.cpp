@@ -0,0 +1,12 @@
+#ifdef _WIN32
+#include "PALMemory.hpp"
+
+#include <malloc.h>
+
+void* PALAllocateAlignedMemory(std::size_t byteCount, std::size_t alignment, bool) {
+	return _aligned_malloc(byteCount, alignment);
+}
+void PALDeallocateAlignedMemory(void* pointer) noexcept {
+	_aligned_free(pointer);
+}
+#endif
\ No newline at end of file